@@ -0,0 +1,117 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <sbkpython.h>
+#include <shiboken.h>
+
+#include "glue/qpycolumnartablemodel_glue.h"
+
+#include <limits>
+
+PySideBufferColumn *PySideBufferColumn::create(PyObject *obj)
+{
+    if (!PyObject_CheckBuffer(obj))
+        return nullptr;
+    Py_buffer view;
+    const ItemType type = PySide::Buffer::getNumericBuffer(obj, 1, &view);
+    if (type == ItemType::Invalid)
+        return nullptr;
+    if (view.shape[0] > std::numeric_limits<int>::max()) {
+        PyBuffer_Release(&view);
+        PyErr_SetString(PyExc_OverflowError, "Column buffer has too many items.");
+        return nullptr;
+    }
+    return new PySideBufferColumn(view, type);
+}
+
+PySideBufferColumn::PySideBufferColumn(const Py_buffer &view, ItemType type) :
+    m_view(view),
+    m_data(static_cast<const char *>(view.buf)),
+    m_stride(view.strides != nullptr ? view.strides[0] : view.itemsize),
+    m_size(int(view.shape[0])),
+    m_type(type)
+{
+}
+
+PySideBufferColumn::~PySideBufferColumn()
+{
+    if (Py_IsInitialized()) {
+        Shiboken::GilState state;
+        PyBuffer_Release(&m_view);
+    }
+}
+
+int PySideBufferColumn::size() const
+{
+    return m_size;
+}
+
+QVariant PySideBufferColumn::value(int row) const
+{
+    using PySide::Buffer::readItemAs;
+
+    const char *item = m_data + row * m_stride;
+    switch (m_type) {
+    case ItemType::Bool:
+        return QVariant(*item != 0);
+    case ItemType::Int8:
+        return QVariant(int(readItemAs<qint8>(item)));
+    case ItemType::UInt8:
+        return QVariant(uint(readItemAs<quint8>(item)));
+    case ItemType::Int16:
+        return QVariant(int(readItemAs<qint16>(item)));
+    case ItemType::UInt16:
+        return QVariant(uint(readItemAs<quint16>(item)));
+    case ItemType::Int32:
+        return QVariant(int(readItemAs<qint32>(item)));
+    case ItemType::UInt32:
+        return QVariant(uint(readItemAs<quint32>(item)));
+    case ItemType::Int64:
+        return QVariant(readItemAs<qint64>(item));
+    case ItemType::UInt64:
+        return QVariant(readItemAs<quint64>(item));
+    case ItemType::Float:
+        return QVariant(double(readItemAs<float>(item)));
+    case ItemType::Double:
+        return QVariant(readItemAs<double>(item));
+    case ItemType::Invalid:
+        break;
+    }
+    return QVariant();
+}
@@ -0,0 +1,76 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef __QPYCOLUMNARTABLEMODEL_GLUE__
+#define __QPYCOLUMNARTABLEMODEL_GLUE__
+
+#include <sbkpython.h>
+#include <pysidebuffer.h>
+#include <qpycolumnartablemodel.h>
+
+// Column backed by a one-dimensional buffer-protocol object. The buffer is
+// held for the lifetime of the column, which keeps the exporter alive and
+// prevents it from being resized, so value() can read it without the GIL.
+class PySideBufferColumn : public QPyAbstractColumn
+{
+public:
+    // Returns nullptr without an exception set if obj does not support the
+    // buffer protocol. Returns nullptr with an exception set if the buffer
+    // cannot be obtained or is not a one-dimensional buffer of numbers; byte
+    // strings are not accepted as numeric columns.
+    static PySideBufferColumn *create(PyObject *obj);
+
+    ~PySideBufferColumn() override;
+
+    int size() const override;
+    QVariant value(int row) const override;
+
+private:
+    using ItemType = PySide::Buffer::ItemType;
+
+    PySideBufferColumn(const Py_buffer &view, ItemType type);
+
+    Py_buffer m_view;
+    const char *m_data;
+    Py_ssize_t m_stride;
+    int m_size;
+    ItemType m_type;
+};
+
+#endif
@@ -40,3 +40,127 @@
 // @snippet qchart-releaseownership
 Shiboken::Object::releaseOwnership(%PYARG_1);
 // @snippet qchart-releaseownership
+
+// @snippet qxyseries-buffer-helpers
+// Conversion of numeric buffers (numpy arrays, array.array...) to points
+// without creating a QPointF wrapper per point. The points are built with
+// the GIL released by loops that PySide::Buffer::visit() instantiates per
+// item type.
+
+// Sets the x (or y) coordinates of points from a 1D buffer.
+template <bool IsY>
+struct SbkQXYSeries_CoordinateReader
+{
+    template <class Item>
+    void operator()(Item) const
+    {
+        const char *data = static_cast<const char *>(view.buf);
+        for (int i = 0; i < size; ++i) {
+            const qreal value = qreal(PySide::Buffer::readItemAs<Item>(data + i * view.strides[0]));
+            if (IsY)
+                points[i].setY(value);
+            else
+                points[i].setX(value);
+        }
+    }
+
+    const Py_buffer &view;
+    QPointF *points;
+    int size;
+};
+
+// Sets points from a (N, 2) buffer of x, y pairs.
+struct SbkQXYSeries_PointReader
+{
+    template <class Item>
+    void operator()(Item) const
+    {
+        for (int i = 0; i < size; ++i) {
+            const char *item = static_cast<const char *>(view.buf) + i * view.strides[0];
+            points[i] = QPointF(qreal(PySide::Buffer::readItemAs<Item>(item)),
+                                qreal(PySide::Buffer::readItemAs<Item>(item + view.strides[1])));
+        }
+    }
+
+    const Py_buffer &view;
+    QPointF *points;
+    int size;
+};
+
+// Points from two 1D buffers of x and y values.
+static bool SbkQXYSeries_pointsFromBuffers(PyObject *pyX, PyObject *pyY, QVector<QPointF> *points)
+{
+    using PySide::Buffer::ItemType;
+
+    Py_buffer x;
+    const ItemType xType = PySide::Buffer::getNumericBuffer(pyX, 1, &x);
+    if (xType == ItemType::Invalid)
+        return false;
+    Py_buffer y;
+    const ItemType yType = PySide::Buffer::getNumericBuffer(pyY, 1, &y);
+    if (yType == ItemType::Invalid) {
+        PyBuffer_Release(&x);
+        return false;
+    }
+    const bool ok = x.shape[0] == y.shape[0];
+    if (ok) {
+        Py_BEGIN_ALLOW_THREADS
+        const int size = int(x.shape[0]);
+        points->resize(size);
+        PySide::Buffer::visit(xType, SbkQXYSeries_CoordinateReader<false>{x, points->data(), size});
+        PySide::Buffer::visit(yType, SbkQXYSeries_CoordinateReader<true>{y, points->data(), size});
+        Py_END_ALLOW_THREADS
+    } else {
+        PyErr_Format(PyExc_ValueError, "The x and y buffers differ in size (%zd, %zd).",
+                     x.shape[0], y.shape[0]);
+    }
+    PyBuffer_Release(&y);
+    PyBuffer_Release(&x);
+    return ok;
+}
+
+// Points from a (N, 2) buffer of x, y pairs.
+static bool SbkQXYSeries_pointsFromBuffer(PyObject *pyXY, QVector<QPointF> *points)
+{
+    Py_buffer xy;
+    const PySide::Buffer::ItemType type = PySide::Buffer::getNumericBuffer(pyXY, 2, &xy);
+    if (type == PySide::Buffer::ItemType::Invalid)
+        return false;
+    const bool ok = xy.shape[1] == 2;
+    if (ok) {
+        Py_BEGIN_ALLOW_THREADS
+        const int size = int(xy.shape[0]);
+        points->resize(size);
+        PySide::Buffer::visit(type, SbkQXYSeries_PointReader{xy, points->data(), size});
+        Py_END_ALLOW_THREADS
+    } else {
+        PyErr_SetString(PyExc_ValueError, "Expected a buffer of shape (N, 2).");
+    }
+    PyBuffer_Release(&xy);
+    return ok;
+}
+// @snippet qxyseries-buffer-helpers
+
+// @snippet qxyseries-appendnp-xy
+QVector<QPointF> points;
+if (SbkQXYSeries_pointsFromBuffers(%PYARG_1, %PYARG_2, &points))
+    %CPPSELF.append(points.toList());
+// @snippet qxyseries-appendnp-xy
+
+// @snippet qxyseries-appendnp-points
+QVector<QPointF> points;
+if (SbkQXYSeries_pointsFromBuffer(%PYARG_1, &points))
+    %CPPSELF.append(points.toList());
+// @snippet qxyseries-appendnp-points
+
+// @snippet qxyseries-replacenp-xy
+QVector<QPointF> points;
+if (SbkQXYSeries_pointsFromBuffers(%PYARG_1, %PYARG_2, &points))
+    %CPPSELF.replace(points);
+// @snippet qxyseries-replacenp-xy
+
+// @snippet qxyseries-replacenp-points
+QVector<QPointF> points;
+if (SbkQXYSeries_pointsFromBuffer(%PYARG_1, &points))
+    %CPPSELF.replace(points);
+// @snippet qxyseries-replacenp-points
@@ -289,6 +289,174 @@ static bool QVariantType_checkAllStringKeys(PyObject *dict)
 }
 // @snippet qvariantmap-check
 
+// @snippet qjson-topython
+// Direct conversions between the QJson classes and Python objects, avoiding
+// the deep copies made by going through QVariantMap/QVariantList.
+static PyObject *QJsonValue_toPython(const QJsonValue &value);
+
+static PyObject *QJsonObject_toPython(const QJsonObject &object)
+{
+    PyObject *dict = PyDict_New();
+    for (auto it = object.constBegin(), end = object.constEnd(); it != end; ++it) {
+        Shiboken::AutoDecRef key(%CONVERTTOPYTHON[QString](it.key()));
+        Shiboken::AutoDecRef item(QJsonValue_toPython(it.value()));
+        if (item.isNull() || PyDict_SetItem(dict, key, item) < 0) {
+            Py_DECREF(dict);
+            return nullptr;
+        }
+    }
+    return dict;
+}
+
+static PyObject *QJsonArray_toPython(const QJsonArray &array)
+{
+    PyObject *list = PyList_New(array.size());
+    Py_ssize_t i = 0;
+    for (const QJsonValue &value : array) {
+        PyObject *item = QJsonValue_toPython(value);
+        if (!item) {
+            Py_DECREF(list);
+            return nullptr;
+        }
+        PyList_SET_ITEM(list, i++, item);
+    }
+    return list;
+}
+
+static PyObject *QJsonValue_toPython(const QJsonValue &value)
+{
+    switch (value.type()) {
+    case QJsonValue::Bool:
+        return PyBool_FromLong(value.toBool());
+    case QJsonValue::Double:
+        return PyFloat_FromDouble(value.toDouble());
+    case QJsonValue::String:
+        return %CONVERTTOPYTHON[QString](value.toString());
+    case QJsonValue::Array:
+        return QJsonArray_toPython(value.toArray());
+    case QJsonValue::Object:
+        return QJsonObject_toPython(value.toObject());
+    case QJsonValue::Null:
+    case QJsonValue::Undefined:
+        break;
+    }
+    Py_RETURN_NONE;
+}
+// @snippet qjson-topython
+
+// @snippet qjson-frompython
+// Returns false with a Python error set if a dictionary has keys which are
+// not strings, an integer is too large for a double or containers are nested
+// too deeply (self-referencing ones, for example).
+static bool QJsonValue_fromPython(PyObject *pyIn, QJsonValue *value);
+
+// Py_EnterRecursiveCall() is part of the limited API only as of Python 3.9,
+// so limited API builds count the depth themselves (protected by the GIL).
+#ifdef Py_LIMITED_API
+static int QJsonValue_recursionDepth = 0;
+
+static bool QJsonValue_enterRecursiveCall()
+{
+    if (++QJsonValue_recursionDepth > Py_GetRecursionLimit()) {
+        --QJsonValue_recursionDepth;
+        PyErr_SetString(PyExc_RecursionError,
+                        "maximum recursion depth exceeded while converting to QJsonValue");
+        return false;
+    }
+    return true;
+}
+
+static void QJsonValue_leaveRecursiveCall()
+{
+    --QJsonValue_recursionDepth;
+}
+#else // Py_LIMITED_API
+static bool QJsonValue_enterRecursiveCall()
+{
+    return Py_EnterRecursiveCall(" while converting to QJsonValue") == 0;
+}
+
+static void QJsonValue_leaveRecursiveCall()
+{
+    Py_LeaveRecursiveCall();
+}
+#endif // !Py_LIMITED_API
+
+static bool QJsonObject_fromPython(PyObject *dict, QJsonObject *object)
+{
+    Py_ssize_t pos = 0;
+    PyObject *key;
+    PyObject *item;
+    while (PyDict_Next(dict, &pos, &key, &item)) {
+        if (!%CHECKTYPE[QString](key)) {
+            PyErr_Format(PyExc_TypeError, "QJsonObject keys must be strings, not '%s'",
+                         Py_TYPE(key)->tp_name);
+            return false;
+        }
+        QJsonValue value;
+        if (!QJsonValue_fromPython(item, &value))
+            return false;
+        object->insert(%CONVERTTOCPP[QString](key), value);
+    }
+    return true;
+}
+
+static bool QJsonValue_fromPython(PyObject *pyIn, QJsonValue *value)
+{
+    if (pyIn == Py_None) {
+        *value = QJsonValue(QJsonValue::Null);
+    } else if (PyBool_Check(pyIn)) {
+        *value = QJsonValue(pyIn == Py_True);
+    } else if (PyFloat_Check(pyIn)) {
+        *value = QJsonValue(PyFloat_AS_DOUBLE(pyIn));
+    } else if (PyLong_Check(pyIn) || PyInt_Check(pyIn)) {
+        const qint64 number = PyLong_AsLongLong(pyIn);
+        if (number == -1 && PyErr_Occurred()) {
+            // Beyond 64 bit, like other JSON numbers, unless it overflows a double
+            PyErr_Clear();
+            const double approximation = PyLong_AsDouble(pyIn);
+            if (approximation == -1.0 && PyErr_Occurred())
+                return false;
+            *value = QJsonValue(approximation);
+        } else {
+            *value = QJsonValue(number);
+        }
+    } else if (Shiboken::String::check(pyIn)) {
+        *value = QJsonValue(%CONVERTTOCPP[QString](pyIn));
+    } else if (PyDict_Check(pyIn)) {
+        if (!QJsonValue_enterRecursiveCall())
+            return false;
+        QJsonObject object;
+        const bool ok = QJsonObject_fromPython(pyIn, &object);
+        QJsonValue_leaveRecursiveCall();
+        if (!ok)
+            return false;
+        *value = QJsonValue(object);
+    } else if (PyList_Check(pyIn) || PyTuple_Check(pyIn)) {
+        if (!QJsonValue_enterRecursiveCall())
+            return false;
+        QJsonArray array;
+        Shiboken::AutoDecRef fast(PySequence_Fast(pyIn, "Failed to convert QJsonArray"));
+        const Py_ssize_t size = PySequence_Fast_GET_SIZE(fast.object());
+        bool ok = true;
+        for (Py_ssize_t i = 0; ok && i < size; ++i) {
+            QJsonValue item;
+            ok = QJsonValue_fromPython(PySequence_Fast_GET_ITEM(fast.object(), i), &item);
+            if (ok)
+                array.append(item);
+        }
+        QJsonValue_leaveRecursiveCall();
+        if (!ok)
+            return false;
+        *value = QJsonValue(array);
+    } else {
+        *value = QJsonValue::fromVariant(%CONVERTTOCPP[QVariant](pyIn));
+        return !PyErr_Occurred();
+    }
+    return true;
+}
+// @snippet qjson-frompython
+
 // @snippet qt-qabs
 double _abs = qAbs(%1);
 %PYARG_0 = %CONVERTTOPYTHON[double](_abs);
@@ -1663,6 +1831,60 @@ Py_END_ALLOW_THREADS
 %PYARG_0 = Shiboken::String::fromCString(ba.constData());
 // @snippet qiodevice-readData
 
+// @snippet qiodevice-readinto
+// Read directly into a writable, contiguous buffer (bytearray, memoryview,
+// numpy array...) without intermediate QByteArray.
+Py_buffer view;
+if (PyObject_GetBuffer(%PYARG_1, &view, PyBUF_SIMPLE | PyBUF_WRITABLE) == 0) {
+    const qint64 maxSize = %2 >= 0 && %2 < view.len ? %2 : qint64(view.len);
+    qint64 bytesRead = 0;
+    Py_BEGIN_ALLOW_THREADS
+    bytesRead = %CPPSELF.read(static_cast<char *>(view.buf), maxSize);
+    Py_END_ALLOW_THREADS
+    PyBuffer_Release(&view);
+    %PYARG_0 = %CONVERTTOPYTHON[qint64](bytesRead);
+}
+// @snippet qiodevice-readinto
+
+// @snippet qpycolumnartablemodel-setcolumn
+// Numeric buffers are referenced as-is; any other sequence is converted to
+// strings once, None items leaving the cell without data. Passing None for
+// the values removes the role from the column.
+if (%PYARG_2 == Py_None) {
+    %CPPSELF.removeColumnRole(%1, %3);
+} else if (QPyAbstractColumn *column = PySideBufferColumn::create(%PYARG_2)) {
+    %CPPSELF.setColumn(%1, column, %3);
+} else if (!PyErr_Occurred()) {
+    if (Shiboken::String::check(%PYARG_2) || !PySequence_Check(%PYARG_2)) {
+        PyErr_SetString(PyExc_TypeError, "setColumn() expects a buffer or a sequence.");
+    } else {
+        const Py_ssize_t size = PySequence_Size(%PYARG_2);
+        QStringList values;
+        values.reserve(int(size));
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            Shiboken::AutoDecRef item(PySequence_GetItem(%PYARG_2, i));
+            if (item.isNull())
+                break;
+            if (item.object() == Py_None) {
+                values.append(QString());
+                continue;
+            }
+            PyObject *text = item.object();
+            Shiboken::AutoDecRef converted(static_cast<PyObject *>(nullptr));
+            if (!Shiboken::String::check(text)) {
+                converted.reset(PyObject_Str(text));
+                if (converted.isNull())
+                    break;
+                text = converted.object();
+            }
+            values.append(%CONVERTTOCPP[QString](text));
+        }
+        if (!PyErr_Occurred())
+            %CPPSELF.setColumnStrings(%1, values, %3);
+    }
+}
+// @snippet qpycolumnartablemodel-setcolumn
+
 // @snippet qt-module-shutdown
 { // Avoid name clash
     Shiboken::AutoDecRef regFunc(static_cast<PyObject *>(nullptr));
@@ -1844,9 +2066,9 @@ else
 // @snippet conversion-qvariant-pysequence
 
 // @snippet conversion-qjsonobject-pydict
-QVariant dict = QVariant_convertToVariantMap(%in);
-QJsonValue val = QJsonValue::fromVariant(dict);
-%out = val.toObject();
+// Raises TypeError for keys which are not strings
+%out = QJsonObject();
+QJsonObject_fromPython(%in, &%out);
 // @snippet conversion-qjsonobject-pydict
 
 // @snippet conversion-qpair-pysequence
@@ -1979,15 +2201,20 @@ return %out;
 // @snippet return-qvariant-type
 
 // @snippet return-qjsonobject
-// The QVariantMap returned by QJsonObject seems to cause a segfault, so
-// using QJsonObject.toVariantMap() won't work.
-// Wrapping it in a QJsonValue first allows it to work
-QJsonValue val(%in);
-QVariant ret = val.toVariant();
-
-return %CONVERTTOPYTHON[QVariant](ret);
+return QJsonObject_toPython(%in);
 // @snippet return-qjsonobject
 
+// @snippet qjsondocument-topython
+if (%CPPSELF.isObject()) {
+    %PYARG_0 = QJsonObject_toPython(%CPPSELF.object());
+} else if (%CPPSELF.isArray()) {
+    %PYARG_0 = QJsonArray_toPython(%CPPSELF.array());
+} else {
+    Py_INCREF(Py_None);
+    %PYARG_0 = Py_None;
+}
+// @snippet qjsondocument-topython
+
 // @snippet return-qpair
 PyObject *%out = PyTuple_New(2);
 PyTuple_SET_ITEM(%out, 0, %CONVERTTOPYTHON[%INTYPE_0](%in.first));
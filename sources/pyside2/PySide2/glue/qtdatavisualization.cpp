@@ -40,3 +40,153 @@
 // @snippet releaseownership
 Shiboken::Object::releaseOwnership(%PYARG_1);
 // @snippet releaseownership
+
+// @snippet dataproxy-buffer-helpers
+// Bulk conversion of 2D/3D buffers of float or double items (numpy arrays,
+// for example) to data arrays. The rows are filled with the GIL released by
+// loops instantiated for float and double items.
+
+// Returns a buffer view with \a ndim dimensions, setting an exception and
+// returning false if obj is not a buffer of float or double items.
+static bool SbkDataVisualization_getBuffer(PyObject *obj, int ndim, Py_buffer *view,
+                                           PySide::Buffer::ItemType *type)
+{
+    using PySide::Buffer::ItemType;
+
+    *type = PySide::Buffer::getNumericBuffer(obj, ndim, view);
+    if (*type == ItemType::Invalid)
+        return false;
+    if (*type != ItemType::Float && *type != ItemType::Double) {
+        PyErr_Format(PyExc_TypeError, "Expected a buffer of float or double items, got format '%s'.",
+                     view->format != nullptr ? view->format : "B");
+        PyBuffer_Release(view);
+        return false;
+    }
+    return true;
+}
+
+// @snippet dataproxy-buffer-helpers
+
+// @snippet qsurfacedataproxy-buffer-helpers
+// Surface from a (rows, columns) height field on a regular x/z grid.
+template <class Item>
+static QtDataVisualization::QSurfaceDataArray *
+    SbkDataVisualization_surfaceFromHeights(const Py_buffer &view, float x, float deltaX,
+                                            float z, float deltaZ)
+{
+    const int rowCount = int(view.shape[0]);
+    const int columnCount = int(view.shape[1]);
+    auto *result = new QtDataVisualization::QSurfaceDataArray;
+    result->reserve(rowCount);
+    for (int r = 0; r < rowCount; ++r) {
+        const char *rowData = static_cast<const char *>(view.buf) + r * view.strides[0];
+        const float rowZ = z + float(r) * deltaZ;
+        auto *row = new QtDataVisualization::QSurfaceDataRow(columnCount);
+        QtDataVisualization::QSurfaceDataItem *items = row->data();
+        for (int c = 0; c < columnCount; ++c) {
+            const float y = float(PySide::Buffer::readItemAs<Item>(rowData + c * view.strides[1]));
+            items[c].setPosition(QVector3D(x + float(c) * deltaX, y, rowZ));
+        }
+        result->append(row);
+    }
+    return result;
+}
+
+// Surface from a (rows, columns, 3) buffer of x, y, z positions.
+template <class Item>
+static QtDataVisualization::QSurfaceDataArray *
+    SbkDataVisualization_surfaceFromPositions(const Py_buffer &view)
+{
+    const int rowCount = int(view.shape[0]);
+    const int columnCount = int(view.shape[1]);
+    auto *result = new QtDataVisualization::QSurfaceDataArray;
+    result->reserve(rowCount);
+    for (int r = 0; r < rowCount; ++r) {
+        const char *rowData = static_cast<const char *>(view.buf) + r * view.strides[0];
+        auto *row = new QtDataVisualization::QSurfaceDataRow(columnCount);
+        QtDataVisualization::QSurfaceDataItem *items = row->data();
+        for (int c = 0; c < columnCount; ++c) {
+            const char *position = rowData + c * view.strides[1];
+            const char *y = position + view.strides[2];
+            const char *z = y + view.strides[2];
+            items[c].setPosition(QVector3D(float(PySide::Buffer::readItemAs<Item>(position)),
+                                           float(PySide::Buffer::readItemAs<Item>(y)),
+                                           float(PySide::Buffer::readItemAs<Item>(z))));
+        }
+        result->append(row);
+    }
+    return result;
+}
+
+// @snippet qsurfacedataproxy-buffer-helpers
+
+// @snippet qbardataproxy-buffer-helpers
+// Bars from a (rows, columns) buffer of values.
+template <class Item>
+static QtDataVisualization::QBarDataArray *SbkDataVisualization_barsFromValues(const Py_buffer &view)
+{
+    const int rowCount = int(view.shape[0]);
+    const int columnCount = int(view.shape[1]);
+    auto *result = new QtDataVisualization::QBarDataArray;
+    result->reserve(rowCount);
+    for (int r = 0; r < rowCount; ++r) {
+        const char *rowData = static_cast<const char *>(view.buf) + r * view.strides[0];
+        auto *row = new QtDataVisualization::QBarDataRow(columnCount);
+        QtDataVisualization::QBarDataItem *items = row->data();
+        for (int c = 0; c < columnCount; ++c)
+            items[c].setValue(float(PySide::Buffer::readItemAs<Item>(rowData + c * view.strides[1])));
+        result->append(row);
+    }
+    return result;
+}
+// @snippet qbardataproxy-buffer-helpers
+
+// @snippet qsurfacedataproxy-resetarraynp-heights
+Py_buffer view;
+PySide::Buffer::ItemType type;
+if (SbkDataVisualization_getBuffer(%PYARG_5, 2, &view, &type)) {
+    QtDataVisualization::QSurfaceDataArray *array = nullptr;
+    Py_BEGIN_ALLOW_THREADS
+    array = type == PySide::Buffer::ItemType::Double
+        ? SbkDataVisualization_surfaceFromHeights<double>(view, %1, %2, %3, %4)
+        : SbkDataVisualization_surfaceFromHeights<float>(view, %1, %2, %3, %4);
+    Py_END_ALLOW_THREADS
+    PyBuffer_Release(&view);
+    %CPPSELF.resetArray(array);
+}
+// @snippet qsurfacedataproxy-resetarraynp-heights
+
+// @snippet qsurfacedataproxy-resetarraynp-positions
+Py_buffer view;
+PySide::Buffer::ItemType type;
+if (SbkDataVisualization_getBuffer(%PYARG_1, 3, &view, &type)) {
+    if (view.shape[2] != 3) {
+        PyBuffer_Release(&view);
+        PyErr_SetString(PyExc_ValueError, "Expected a buffer of shape (rows, columns, 3).");
+    } else {
+        QtDataVisualization::QSurfaceDataArray *array = nullptr;
+        Py_BEGIN_ALLOW_THREADS
+        array = type == PySide::Buffer::ItemType::Double
+            ? SbkDataVisualization_surfaceFromPositions<double>(view)
+            : SbkDataVisualization_surfaceFromPositions<float>(view);
+        Py_END_ALLOW_THREADS
+        PyBuffer_Release(&view);
+        %CPPSELF.resetArray(array);
+    }
+}
+// @snippet qsurfacedataproxy-resetarraynp-positions
+
+// @snippet qbardataproxy-resetarraynp
+Py_buffer view;
+PySide::Buffer::ItemType type;
+if (SbkDataVisualization_getBuffer(%PYARG_1, 2, &view, &type)) {
+    QtDataVisualization::QBarDataArray *array = nullptr;
+    Py_BEGIN_ALLOW_THREADS
+    array = type == PySide::Buffer::ItemType::Double
+        ? SbkDataVisualization_barsFromValues<double>(view)
+        : SbkDataVisualization_barsFromValues<float>(view);
+    Py_END_ALLOW_THREADS
+    PyBuffer_Release(&view);
+    %CPPSELF.resetArray(array);
+}
+// @snippet qbardataproxy-resetarraynp
@@ -160,6 +160,197 @@ for (int i = 0, i_max = %CPPSELF.count(); i < i_max; ++i){
 %PYARG_0 = Shiboken::Buffer::newObject(%CPPSELF.%FUNCTION_NAME(%1), %CPPSELF.bytesPerLine(), Shiboken::Buffer::ReadWrite);
 // @snippet qimage-scanline
 
+// @snippet qimage-bufferprotocol
+extern "C" {
+// QImage buffer protocol functions (PEP 3118): the pixel data is exported as
+// a (height, width[, channels]) array with the row stride bytesPerLine().
+// The exporter holds a reference to the image wrapper for the lifetime of
+// the view, so memoryview(image) and numpy.asarray(image) cannot dangle.
+
+// Returns the number of channels and the item size/format of a pixel,
+// false for bit-packed formats which cannot be described.
+static bool SbkQImage_pixelLayout(QImage::Format format, Py_ssize_t *channels,
+                                  Py_ssize_t *itemSize, const char **itemFormat)
+{
+    *channels = 1;
+    *itemSize = 1;
+    *itemFormat = "B";
+    switch (format) {
+    case QImage::Format_Indexed8:
+    case QImage::Format_Alpha8:
+    case QImage::Format_Grayscale8:
+        break;
+    case QImage::Format_RGB16:
+    case QImage::Format_RGB555:
+    case QImage::Format_RGB444:
+    case QImage::Format_ARGB4444_Premultiplied:
+#if QT_VERSION >= QT_VERSION_CHECK(5, 13, 0)
+    case QImage::Format_Grayscale16:
+#endif
+        *itemSize = 2;
+        *itemFormat = "H";
+        break;
+    case QImage::Format_BGR30:
+    case QImage::Format_A2BGR30_Premultiplied:
+    case QImage::Format_RGB30:
+    case QImage::Format_A2RGB30_Premultiplied:
+        *itemSize = 4;
+        *itemFormat = "I";
+        break;
+    case QImage::Format_RGB888:
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    case QImage::Format_BGR888:
+#endif
+    case QImage::Format_RGB666:
+    case QImage::Format_ARGB6666_Premultiplied:
+    case QImage::Format_ARGB8565_Premultiplied:
+    case QImage::Format_ARGB8555_Premultiplied:
+        *channels = 3;
+        break;
+    case QImage::Format_RGB32:
+    case QImage::Format_ARGB32:
+    case QImage::Format_ARGB32_Premultiplied:
+    case QImage::Format_RGBX8888:
+    case QImage::Format_RGBA8888:
+    case QImage::Format_RGBA8888_Premultiplied:
+        *channels = 4;
+        break;
+    case QImage::Format_RGBX64:
+    case QImage::Format_RGBA64:
+    case QImage::Format_RGBA64_Premultiplied:
+        *channels = 4;
+        *itemSize = 2;
+        *itemFormat = "H";
+        break;
+    default: // Format_Invalid, Format_Mono, Format_MonoLSB
+        return false;
+    }
+    return true;
+}
+
+// Image data of an exported buffer and its shape and strides, released in
+// SbkQImage_releasebufferproc()
+struct SbkQImageExport
+{
+    QImage image;
+    Py_ssize_t layout[6];
+};
+
+static int SbkQImage_getbufferproc(PyObject *obj, Py_buffer *view, int flags)
+{
+    if (!view || !Shiboken::Object::isValid(obj))
+        return -1;
+
+    QImage *cppSelf = %CONVERTTOCPP[QImage *](obj);
+    //XXX  /|\ omitting this space crashes shiboken!
+    Py_ssize_t channels, itemSize;
+    const char *itemFormat;
+    if (cppSelf->isNull() || !SbkQImage_pixelLayout(cppSelf->format(), &channels, &itemSize, &itemFormat)) {
+        PyErr_SetString(PyExc_BufferError, "QImage: null image or pixel format not exportable as buffer");
+        return -1;
+    }
+    const Py_ssize_t height = cppSelf->height();
+    const Py_ssize_t width = cppSelf->width();
+    const Py_ssize_t bytesPerLine = cppSelf->bytesPerLine();
+    const Py_ssize_t bytesPerPixel = channels * itemSize;
+    const bool padded = bytesPerLine != width * bytesPerPixel;
+    if (padded && (flags & PyBUF_STRIDES) == PyBUF_ND) {
+        PyErr_SetString(PyExc_BufferError, "QImage: scan lines are padded, strides are required");
+        return -1;
+    }
+    // Rows are stored one after the other, so the view is never Fortran
+    // contiguous and only C contiguous without padding.
+    if ((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS) {
+        PyErr_SetString(PyExc_BufferError, "QImage: the pixel data is not Fortran contiguous");
+        return -1;
+    }
+    if (padded && ((flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS
+                   || (flags & PyBUF_ANY_CONTIGUOUS) == PyBUF_ANY_CONTIGUOUS)) {
+        PyErr_SetString(PyExc_BufferError, "QImage: scan lines are padded, the pixel data is not contiguous");
+        return -1;
+    }
+
+    // Like bits(), the export is always writable and detaches the image since
+    // consumers like numpy request read-only views first. The exported memory
+    // is owned by a shallow copy of the image, so that it stays valid when the
+    // image is reloaded, assigned or detached while the view is alive.
+    cppSelf->bits();
+    auto *exported = new SbkQImageExport{*cppSelf, {height, width, channels,
+                                                    bytesPerLine, bytesPerPixel, itemSize}};
+    view->buf = const_cast<uchar *>(exported->image.constBits());
+    view->obj = obj;
+    view->readonly = 0;
+    view->suboffsets = nullptr;
+    view->internal = exported;
+    if ((flags & PyBUF_ND) != PyBUF_ND) {
+        // Plain bytes of all scan lines including padding
+        view->len = bytesPerLine * height;
+        view->itemsize = 1;
+        view->format = nullptr;
+        view->ndim = 1;
+        view->shape = nullptr;
+        view->strides = nullptr;
+    } else {
+        Py_ssize_t *layout = exported->layout;
+        view->len = height * width * bytesPerPixel;
+        view->itemsize = itemSize;
+        view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT
+            ? const_cast<char *>(itemFormat) : nullptr;
+        view->ndim = channels > 1 ? 3 : 2;
+        view->shape = layout;
+        view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? layout + 3 : nullptr;
+    }
+
+    Py_INCREF(obj);
+    return 0;
+}
+
+static void SbkQImage_releasebufferproc(PyObject * /* obj */, Py_buffer *view)
+{
+    delete static_cast<SbkQImageExport *>(view->internal);
+    view->internal = nullptr;
+}
+
+#if PY_VERSION_HEX >= 0x03000000
+static PyBufferProcs SbkQImageBufferProc = {
+    /*bf_getbuffer*/  (getbufferproc)SbkQImage_getbufferproc,
+    /*bf_releasebuffer*/ (releasebufferproc)SbkQImage_releasebufferproc,
+};
+#endif
+
+// Buffer of a Python object wrapped by QImage(buffer, width, height, ...),
+// released by the image cleanup function when the last copy of the image
+// data is gone.
+static Py_buffer *SbkQImage_acquireBuffer(PyObject *obj)
+{
+    auto *view = new Py_buffer;
+    if (PyObject_GetBuffer(obj, view, PyBUF_ND | PyBUF_WRITABLE) == 0)
+        return view;
+    PyErr_Clear();
+    if (PyObject_GetBuffer(obj, view, PyBUF_ND) == 0)
+        return view;
+    delete view;
+    return nullptr;
+}
+
+static void SbkQImage_releaseBuffer(void *info)
+{
+    auto *view = static_cast<Py_buffer *>(info);
+    if (Py_IsInitialized()) {
+        Shiboken::GilState state;
+        PyBuffer_Release(view);
+    }
+    delete view;
+}
+}
+// @snippet qimage-bufferprotocol
+
+// @snippet qimage-buffer-init
+#if PY_VERSION_HEX >= 0x03000000
+PepType_AS_BUFFER(Shiboken::SbkType<QImage>()) = &SbkQImageBufferProc;
+#endif
+// @snippet qimage-buffer-init
+
 // @snippet qcolor-setstate
 Shiboken::AutoDecRef func(PyObject_GetAttr(%PYSELF, PyTuple_GET_ITEM(%1, 0)));
 PyObject *args = PyTuple_GET_ITEM(%1, 1);
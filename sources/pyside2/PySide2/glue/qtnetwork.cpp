@@ -38,19 +38,69 @@
 ****************************************************************************/
 
 // @snippet qudpsocket-readdatagram
-Shiboken::AutoArrayPointer<char> data(%ARGUMENT_NAMES);
+QByteArray ba(int(%ARGUMENT_NAMES), Qt::Uninitialized);
 QHostAddress ha;
 quint16 port;
 %BEGIN_ALLOW_THREADS
-%RETURN_TYPE retval = %CPPSELF.%FUNCTION_NAME(data, %ARGUMENT_NAMES, &ha, &port);
+%RETURN_TYPE retval = %CPPSELF.%FUNCTION_NAME(ba.data(), %ARGUMENT_NAMES, &ha, &port);
 %END_ALLOW_THREADS
-QByteArray ba(data, retval);
+ba.resize(retval > 0 ? int(retval) : 0);
 %PYARG_0 = PyTuple_New(3);
 PyTuple_SET_ITEM(%PYARG_0, 0, %CONVERTTOPYTHON[QByteArray](ba));
 PyTuple_SET_ITEM(%PYARG_0, 1, %CONVERTTOPYTHON[QHostAddress](ha));
 PyTuple_SET_ITEM(%PYARG_0, 2, %CONVERTTOPYTHON[quint16](port));
 // @snippet qudpsocket-readdatagram
 
+// @snippet qudpsocket-readdatagraminto
+Py_buffer view;
+if (PyObject_GetBuffer(%PYARG_1, &view, PyBUF_SIMPLE | PyBUF_WRITABLE) == 0) {
+    QHostAddress ha;
+    quint16 port = 0;
+    qint64 retval = 0;
+    Py_BEGIN_ALLOW_THREADS
+    retval = %CPPSELF.readDatagram(static_cast<char *>(view.buf), view.len, &ha, &port);
+    Py_END_ALLOW_THREADS
+    PyBuffer_Release(&view);
+    %PYARG_0 = PyTuple_New(3);
+    PyTuple_SET_ITEM(%PYARG_0, 0, %CONVERTTOPYTHON[qint64](retval));
+    PyTuple_SET_ITEM(%PYARG_0, 1, %CONVERTTOPYTHON[QHostAddress](ha));
+    PyTuple_SET_ITEM(%PYARG_0, 2, %CONVERTTOPYTHON[quint16](port));
+}
+// @snippet qudpsocket-readdatagraminto
+
+// @snippet qudpsocket-readdatagrams
+// Read up to maxCount pending datagrams in one call with the GIL released
+// for the whole batch.
+struct PendingDatagram
+{
+    QByteArray data;
+    QHostAddress address;
+    quint16 port;
+};
+QVector<PendingDatagram> datagrams;
+Py_BEGIN_ALLOW_THREADS
+while ((%1 < 0 || datagrams.size() < %1) && %CPPSELF.hasPendingDatagrams()) {
+    const qint64 size = %CPPSELF.pendingDatagramSize();
+    PendingDatagram datagram{QByteArray(int(qMax(size, qint64(0))), Qt::Uninitialized), {}, 0};
+    const qint64 read = %CPPSELF.readDatagram(datagram.data.data(), datagram.data.size(),
+                                              &datagram.address, &datagram.port);
+    if (read < 0)
+        break;
+    datagram.data.resize(int(read));
+    datagrams.append(datagram);
+}
+Py_END_ALLOW_THREADS
+%PYARG_0 = PyList_New(datagrams.size());
+for (int i = 0, size = datagrams.size(); i < size; ++i) {
+    const PendingDatagram &datagram = datagrams.at(i);
+    PyObject *item = PyTuple_New(3);
+    PyTuple_SET_ITEM(item, 0, %CONVERTTOPYTHON[QByteArray](datagram.data));
+    PyTuple_SET_ITEM(item, 1, %CONVERTTOPYTHON[QHostAddress](datagram.address));
+    PyTuple_SET_ITEM(item, 2, %CONVERTTOPYTHON[quint16](datagram.port));
+    PyList_SET_ITEM(%PYARG_0, i, item);
+}
+// @snippet qudpsocket-readdatagrams
+
 // @snippet qipv6address-len
 return 16;
 // @snippet qipv6address-len
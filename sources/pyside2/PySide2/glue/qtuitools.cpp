@@ -44,34 +44,20 @@
  */
 
 #include <shiboken.h>
+#include <pyside.h>
 #include <QUiLoader>
 #include <QFile>
 #include <QWidget>
 
-static void createChildrenNameAttributes(PyObject *root, QObject *object)
-{
-    for (auto *child : object->children()) {
-        const QByteArray name = child->objectName().toLocal8Bit();
-
-        if (!name.isEmpty() && !name.startsWith("_") && !name.startsWith("qt_")) {
-            Shiboken::AutoDecRef attrName(Py_BuildValue("s", name.constData()));
-            if (!PyObject_HasAttr(root, attrName)) {
-                Shiboken::AutoDecRef pyChild(%CONVERTTOPYTHON[QObject *](child));
-                PyObject_SetAttr(root, attrName, pyChild);
-            }
-            createChildrenNameAttributes(root, child);
-        }
-        createChildrenNameAttributes(root, child);
-    }
-}
-
 static PyObject *QUiLoadedLoadUiFromDevice(QUiLoader *self, QIODevice *dev, QWidget *parent)
 {
     QWidget *wdg = self->load(dev, parent);
 
     if (wdg) {
         PyObject *pyWdg = %CONVERTTOPYTHON[QWidget *](wdg);
-        createChildrenNameAttributes(pyWdg, wdg);
+        // Named children become attributes of the widget; their wrappers
+        // are only created when they are accessed.
+        PySide::registerChildrenNameAttributes(wdg);
         if (parent) {
             Shiboken::AutoDecRef pyParent(%CONVERTTOPYTHON[QWidget *](parent));
             Shiboken::Object::setParent(pyParent, pyWdg);
@@ -110,12 +96,192 @@ registerCustomWidget(%PYARG_1);
 %PYARG_0 = QUiLoaderLoadUiFromFileName(%CPPSELF, %1, %2);
 // @snippet quiloader-load-2
 
+// @snippet loaduitype-helpers
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QHash>
+#include <QProcess>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QXmlStreamReader>
+
+// Results of loadUiType(), keyed by a hash of the .ui file contents.
+static QHash<QByteArray, PyObject *> loadUiTypeCache;
+
+// Maximum number of generated files kept on disk; the least recently used
+// ones are removed beyond that.
+static const int uicCacheMaxEntries = 200;
+
+// Generated Python code is also kept on disk, so that the forms loaded at
+// application startup do not need to run uic again. Setting the environment
+// variable PYSIDE_DISABLE_UIC_CACHE disables this.
+static QString uicCacheDir()
+{
+    if (qEnvironmentVariableIntValue("PYSIDE_DISABLE_UIC_CACHE") > 0)
+        return QString();
+    const QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+    return cacheDir.isEmpty() ? QString() : cacheDir + QLatin1String("/pyside2-uic");
+}
+
+static QString uicCacheFileName(const QByteArray &hash)
+{
+    const QString cacheDir = uicCacheDir();
+    if (cacheDir.isEmpty())
+        return QString();
+    return cacheDir + QLatin1Char('/') + QString::fromLatin1(hash.toHex()) + QLatin1String(".py");
+}
+
+static void evictUicCacheEntries(const QString &cacheDir)
+{
+    const QFileInfoList entries =
+        QDir(cacheDir).entryInfoList({QLatin1String("*.py")}, QDir::Files, QDir::Time);
+    for (int i = uicCacheMaxEntries; i < entries.size(); ++i)
+        QFile::remove(entries.at(i).absoluteFilePath());
+}
+
+static QString pysideModuleAttribute(const char *name)
+{
+    Shiboken::AutoDecRef pyside(PyImport_ImportModule("PySide2"));
+    Shiboken::AutoDecRef value(pyside.isNull()
+                               ? nullptr : PyObject_GetAttrString(pyside, name));
+    if (value.isNull() || !Shiboken::String::check(value)) {
+        PyErr_Clear();
+        return QString();
+    }
+    return %CONVERTTOCPP[QString](value);
+}
+
+// Prefer the uic binary shipped inside the PySide2 package, which avoids
+// starting a Python interpreter for the 'pyside2-uic' wrapper script.
+static QString packagedUic()
+{
+    const QString fileName = pysideModuleAttribute("__file__");
+    if (fileName.isEmpty())
+        return QString();
+    const QString packageDir = QFileInfo(fileName).absolutePath();
+#ifdef Q_OS_WIN
+    const QFileInfo uic(packageDir + QLatin1String("/uic.exe"));
+#else
+    const QFileInfo uic(packageDir + QLatin1String("/uic"));
+#endif
+    return uic.isExecutable() ? uic.absoluteFilePath() : QString();
+}
+
+struct UicCommand
+{
+    QString program;
+    QStringList arguments;
+    // Identifies PySide2 and the uic binary, so that code generated by an
+    // older version is not taken from the cache after an upgrade.
+    QByteArray generatorId;
+};
+
+static UicCommand findUic()
+{
+    UicCommand result;
+    result.program = packagedUic();
+    if (result.program.isEmpty()) {
+        // Use the 'pyside2-uic' wrapper instead of 'uic'
+        // This approach is better than rely on 'uic' since installing
+        // the wheels cover this case.
+        result.program = QLatin1String("pyside2-uic");
+    } else {
+        result.arguments << QLatin1String("-g") << QLatin1String("python");
+    }
+    QString binary = QStandardPaths::findExecutable(result.program);
+    if (binary.isEmpty())
+        binary = result.program;
+    const QFileInfo binaryInfo(binary);
+    result.generatorId = pysideModuleAttribute("__version__").toUtf8() + '\n'
+        + binaryInfo.absoluteFilePath().toUtf8() + '\n'
+        + QByteArray::number(binaryInfo.size()) + '\n'
+        + QByteArray::number(binaryInfo.lastModified().toMSecsSinceEpoch());
+    return result;
+}
+
+static const UicCommand &uicCommand()
+{
+    static const UicCommand result = findUic();
+    return result;
+}
+
+static QByteArray runUic(const QString &uiFileName)
+{
+    const UicCommand &uic = uicCommand();
+    QProcess uicProcess;
+    uicProcess.start(uic.program, uic.arguments + QStringList(uiFileName));
+    if (!uicProcess.waitForFinished()) {
+        qCritical() << "Cannot run '" << uic.program << "': " << uicProcess.errorString() << " - "
+                    << "Exit status " << uicProcess.exitStatus()
+                    << " (" << uicProcess.exitCode() << ")\n"
+                    << "Check if 'pyside2-uic' is in PATH";
+        return QByteArray();
+    }
+    const QByteArray errorOutput = uicProcess.readAllStandardError();
+    if (!errorOutput.isEmpty()) {
+        qCritical().noquote() << errorOutput;
+        return QByteArray();
+    }
+    return uicProcess.readAllStandardOutput();
+}
+
+static QByteArray generatedUiCode(const QString &uiFileName, const QByteArray &hash)
+{
+    const QString cacheFileName = uicCacheFileName(hash);
+    if (!cacheFileName.isEmpty()) {
+        QFile cacheFile(cacheFileName);
+        if (cacheFile.open(QIODevice::ReadOnly)) {
+            // Mark the entry as recently used for the eviction.
+            cacheFile.setFileTime(QDateTime::currentDateTimeUtc(), QFileDevice::FileModificationTime);
+            return cacheFile.readAll();
+        }
+    }
+
+    const QByteArray code = runUic(uiFileName);
+    if (!code.isEmpty() && !cacheFileName.isEmpty()
+        && QDir().mkpath(QFileInfo(cacheFileName).absolutePath())) {
+        QSaveFile cacheFile(cacheFileName);
+        if (cacheFile.open(QIODevice::WriteOnly)) {
+            cacheFile.write(code);
+            if (cacheFile.commit())
+                evictUicCacheEntries(QFileInfo(cacheFileName).absolutePath());
+        }
+    }
+    return code;
+}
+
+// Looks for the first <widget> tag, e.g.:
+//      <widget class="QWidget" name="ThemeWidgetForm">
+// and extracts the information from "class", and "name",
+// to get the baseClassName and className respectively
+static bool uiClassInfo(const QByteArray &uiContents, QByteArray *className, QByteArray *baseClassName)
+{
+    QXmlStreamReader reader(uiContents);
+    while (!reader.atEnd() && baseClassName->isEmpty() && className->isEmpty()) {
+        auto token = reader.readNext();
+        if (token == QXmlStreamReader::StartElement && reader.name() == "widget") {
+            *baseClassName = reader.attributes().value(QLatin1String("class")).toUtf8();
+            *className = reader.attributes().value(QLatin1String("name")).toUtf8();
+        }
+    }
+
+    if (className->isEmpty() || baseClassName->isEmpty() || reader.hasError()) {
+        qCritical() << "An error occurred when parsing the UI file while looking for the class info "
+                    << reader.errorString();
+        return false;
+    }
+    return true;
+}
+// @snippet loaduitype-helpers
+
 // @snippet loaduitype
 /*
 Arguments:
     %PYARG_1 (uifile)
 */
-// 1. Generate the Python code from the UI file
+// 1. Read the UI file
 #ifdef IS_PY3K
 PyObject *strObj = PyUnicode_AsUTF8String(%PYARG_1);
 char *arg1 = PyBytes_AsString(strObj);
@@ -137,30 +303,29 @@ if (uiFileName.isEmpty()) {
     Py_RETURN_NONE;
 }
 
-// Use the 'pyside2-uic' wrapper instead of 'uic'
-// This approach is better than rely on 'uic' since installing
-// the wheels cover this case.
-QString uicBin("pyside2-uic");
-QStringList uicArgs = {QString::fromUtf8(uiFileName)};
-
-QProcess uicProcess;
-uicProcess.start(uicBin, uicArgs);
-if (!uicProcess.waitForFinished()) {
-    qCritical() << "Cannot run 'pyside2-uic': " << uicProcess.errorString() << " - "
-                << "Exit status " << uicProcess.exitStatus()
-                << " (" << uicProcess.exitCode() << ")\n"
-                << "Check if 'pyside2-uic' is in PATH";
+if (!uiFile.open(QIODevice::ReadOnly))
     Py_RETURN_NONE;
+const QByteArray uiContents = uiFile.readAll();
+uiFile.close();
+
+// Forms with the same contents produce the same classes.
+QCryptographicHash uiHash(QCryptographicHash::Sha1);
+uiHash.addData(QByteArray(qVersion()));
+uiHash.addData(uicCommand().generatorId);
+uiHash.addData(uiContents);
+const QByteArray hash = uiHash.result();
+
+if (PyObject *cached = loadUiTypeCache.value(hash)) {
+    Py_INCREF(cached);
+    return cached;
 }
-QByteArray uiFileContent = uicProcess.readAllStandardOutput();
-QByteArray errorOutput = uicProcess.readAllStandardError();
 
-if (!errorOutput.isEmpty()) {
-    qCritical().noquote() << errorOutput;
+// 2. Generate the Python code from the UI file
+QByteArray uiFileContent = generatedUiCode(QString::fromUtf8(uiFileName), hash);
+if (uiFileContent.isEmpty())
     Py_RETURN_NONE;
-}
 
-// 2. Obtain the 'classname' and the Qt base class.
+// 3. Obtain the 'classname' and the Qt base class.
 QByteArray className;
 QByteArray baseClassName;
 
@@ -169,42 +334,22 @@ QByteArray baseClassName;
 
 // Solution
 // Use the XML file
-if (!uiFile.open(QIODevice::ReadOnly))
+if (!uiClassInfo(uiContents, &className, &baseClassName))
     Py_RETURN_NONE;
 
-// This will look for the first <widget> tag, e.g.:
-//      <widget class="QWidget" name="ThemeWidgetForm">
-// and then extract the information from "class", and "name",
-// to get the baseClassName and className respectively
-QXmlStreamReader reader(&uiFile);
-while (!reader.atEnd() && baseClassName.isEmpty() && className.isEmpty()) {
-    auto token = reader.readNext();
-    if (token == QXmlStreamReader::StartElement && reader.name() == "widget") {
-        baseClassName = reader.attributes().value(QLatin1String("class")).toUtf8();
-        className = reader.attributes().value(QLatin1String("name")).toUtf8();
-    }
-}
-
-uiFile.close();
-
-if (className.isEmpty() || baseClassName.isEmpty() || reader.hasError()) {
-    qCritical() << "An error occurred when parsing the UI file while looking for the class info "
-                << reader.errorString();
-    Py_RETURN_NONE;
-}
-
 QByteArray pyClassName("Ui_"+className);
 
 PyObject *module = PyImport_ImportModule("__main__");
 PyObject *loc = PyModule_GetDict(module);
 
-// 3. exec() the code so the class exists in the context: exec(uiFileContent)
+// 4. exec() the code so the class exists in the context: exec(uiFileContent)
 // The context of PyRun_SimpleString is __main__.
 // 'Py_file_input' is the equivalent to using exec(), since it will execute
 // the code, without returning anything.
 Shiboken::AutoDecRef codeUi(Py_CompileString(uiFileContent.constData(), "<stdin>", Py_file_input));
 if (codeUi.isNull()) {
     qCritical() << "Error while compiling the generated Python file";
+    QFile::remove(uicCacheFileName(hash));
     Py_RETURN_NONE;
 }
 PyObject *uiObj = nullptr;
@@ -216,10 +361,11 @@ uiObj = PyEval_EvalCode(reinterpret_cast<PyCodeObject *>(codeUi.object()), loc,
 
 if (uiObj == nullptr) {
     qCritical() << "Error while running exec() on the generated code";
+    QFile::remove(uicCacheFileName(hash));
     Py_RETURN_NONE;
 }
 
-// 4. eval() the name of the class on a variable to return
+// 5. eval() the name of the class on a variable to return
 // 'Py_eval_input' is the equivalent to using eval(), since it will just
 // evaluate an expression.
 Shiboken::AutoDecRef codeClass(Py_CompileString(pyClassName.constData(),"<stdin>", Py_eval_input));
@@ -249,4 +395,6 @@ if (%PYARG_0 == nullptr) {
 }
 PyTuple_SET_ITEM(%PYARG_0, 0, classObj);
 PyTuple_SET_ITEM(%PYARG_0, 1, baseClassObj);
+Py_INCREF(%PYARG_0);
+loadUiTypeCache.insert(hash, %PYARG_0);
 // @snippet loaduitype
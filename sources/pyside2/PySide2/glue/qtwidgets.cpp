@@ -147,17 +147,19 @@ inline PyObject *addActionWithPyObject(QMenu *self, const QIcon &icon, const QSt
 // @snippet qmenu-addaction-3
 
 // @snippet qmenu-clear
-Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
-const auto &actions = %CPPSELF.actions();
-for (auto *act : actions) {
-    if (auto wrapper = bm.retrieveWrapper(act)) {
-        auto pyObj = reinterpret_cast<PyObject *>(wrapper);
-        Py_INCREF(pyObj);
-        Shiboken::Object::setParent(NULL, pyObj);
-        Shiboken::Object::invalidate(pyObj);
-        Py_DECREF(pyObj);
-    }
-}
+// Release the actions which clear() deletes: those owned by the menu and
+// not used by any other widget.
+auto isMenuAction = [](void *cppChild, void *menu) -> bool {
+    auto action = reinterpret_cast<QAction *>(cppChild);
+    auto menuWidget = reinterpret_cast<QWidget *>(menu);
+    if (!action || action->parent() != menuWidget)
+        return false;
+    const auto widgets = action->associatedWidgets();
+    return widgets.size() == 1 && widgets.constFirst() == menuWidget;
+};
+Shiboken::Object::releaseChildren(reinterpret_cast<SbkObject *>(%PYSELF),
+                                  Shiboken::SbkType<QAction>(), true,
+                                  isMenuAction, static_cast<QWidget *>(%CPPSELF));
 // @snippet qmenu-clear
 
 // @snippet qmenubar-glue
@@ -393,39 +395,38 @@ Shiboken::Object::invalidate(%PYARG_1);
 // @snippet qgraphicsscene-addwidget
 %RETURN_TYPE %0 = %CPPSELF.%FUNCTION_NAME(%1, %2);
 %PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
-Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(%PYARG_0), "setWidget(QWidget*)1", %PYARG_1);
+Shiboken::Object::keepStaticReference(reinterpret_cast<SbkObject *>(%PYARG_0), "setWidget(QWidget*)1", %PYARG_1);
 // @snippet qgraphicsscene-addwidget
 
 // @snippet qgraphicsscene-clear
-const QList<QGraphicsItem *> items = %CPPSELF.items();
-Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
-for (auto *item : items) {
-    SbkObject *obj = bm.retrieveWrapper(item);
-    if (obj) {
-        if (reinterpret_cast<PyObject *>(obj)->ob_refcnt > 1) // If the refcnt is 1 the object will vannish anyway.
-            Shiboken::Object::invalidate(obj);
-        Shiboken::Object::removeParent(obj);
-    }
-}
+// Release the top-level items; invalidating them also releases their
+// child items.
+auto isSceneItem = [](void *cppChild, void *scene) -> bool {
+    auto item = reinterpret_cast<QGraphicsItem *>(cppChild);
+    return item && item->scene() == reinterpret_cast<QGraphicsScene *>(scene);
+};
+Shiboken::Object::releaseChildren(reinterpret_cast<SbkObject *>(%PYSELF),
+                                  Shiboken::SbkType<QGraphicsItem>(), true,
+                                  isSceneItem, %CPPSELF);
 %CPPSELF.%FUNCTION_NAME();
 // @snippet qgraphicsscene-clear
 
 // @snippet qtreewidget-clear
-QTreeWidgetItem *rootItem = %CPPSELF.invisibleRootItem();
-Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
-
 // PYSIDE-1251:
 // Since some objects can be created with a parent and without
 // being saved on a local variable (refcount = 1), they will be
-// deleted when setting the parent to nullptr, so we change the loop
-// to do this from the last child to the first, to avoid the case
-// when the child(1) points to the original child(2) in case the
-// first one was removed.
-for (int i = rootItem->childCount() - 1; i >= 0; --i) {
-    QTreeWidgetItem *item = rootItem->child(i);
-    if (SbkObject *wrapper = bm.retrieveWrapper(item))
-        Shiboken::Object::setParent(nullptr, reinterpret_cast<PyObject *>(wrapper));
-}
+// deleted when the parent is removed. releaseChildren() unlinks all
+// top-level items before dropping any reference, so this cannot
+// shift the items still to be visited. The header item is a child of
+// the tree widget as well, but is not deleted by clear().
+auto isTopLevelItem = [](void *cppChild, void *treeWidget) -> bool {
+    auto item = reinterpret_cast<QTreeWidgetItem *>(cppChild);
+    return item && item->parent() == nullptr
+        && item != reinterpret_cast<QTreeWidget *>(treeWidget)->headerItem();
+};
+Shiboken::Object::releaseChildren(reinterpret_cast<SbkObject *>(%PYSELF),
+                                  Shiboken::SbkType<QTreeWidgetItem>(), false,
+                                  isTopLevelItem, %CPPSELF);
 // @snippet qtreewidget-clear
 
 // @snippet qtreewidgetitem
@@ -436,17 +437,13 @@ if (%0)
 // @snippet qtreewidgetitem
 
 // @snippet qlistwidget-clear
-Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
-for (int i = 0, count = %CPPSELF.count(); i < count; ++i) {
-    QListWidgetItem *item = %CPPSELF.item(i);
-    if (auto wrapper = bm.retrieveWrapper(item)) {
-        auto pyObj = reinterpret_cast<PyObject *>(wrapper);
-        Py_INCREF(pyObj);
-        Shiboken::Object::setParent(NULL, pyObj);
-        Shiboken::Object::invalidate(pyObj);
-        Py_DECREF(pyObj);
-    }
-}
+auto isListItem = [](void *cppChild, void *listWidget) -> bool {
+    auto item = reinterpret_cast<QListWidgetItem *>(cppChild);
+    return item && item->listWidget() == reinterpret_cast<QListWidget *>(listWidget);
+};
+Shiboken::Object::releaseChildren(reinterpret_cast<SbkObject *>(%PYSELF),
+                                  Shiboken::SbkType<QListWidgetItem>(), true,
+                                  isListItem, %CPPSELF);
 %CPPSELF.%FUNCTION_NAME();
 // @snippet qlistwidget-clear
 
@@ -516,7 +513,7 @@ static inline void qwidgetSetLayout(QWidget *self, QLayout *layout)
 // @snippet qwidget-glue
 
 // @snippet qwidget-setstyle
-Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(%PYSELF), "__style__",  %PYARG_1);
+Shiboken::Object::keepStaticReference(reinterpret_cast<SbkObject *>(%PYSELF), "__style__",  %PYARG_1);
 // @snippet qwidget-setstyle
 
 // @snippet qwidget-style
@@ -529,7 +526,7 @@ if (myStyle && qApp) {
         Shiboken::Object::setParent(pyApp, %PYARG_0);
         Shiboken::Object::releaseOwnership(%PYARG_0);
     } else {
-        Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(%PYSELF), "__style__",  %PYARG_0);
+        Shiboken::Object::keepStaticReference(reinterpret_cast<SbkObject *>(%PYSELF), "__style__",  %PYARG_0);
     }
 }
 // @snippet qwidget-style
@@ -0,0 +1,206 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qpycolumnartablemodel.h"
+
+#include <algorithm>
+
+/*!
+    \class QPyColumnarTableModel
+    \brief Table model whose columns are supplied in bulk instead of through data() overrides.
+    \ingroup model-view
+    Each column holds one array of values per item data role, typically a
+    buffer-protocol object (numpy array, array.array...) for numeric
+    data or a sequence of strings. data() is answered in C++ without calling
+    into Python, which makes scrolling through large tables cheap; Python is
+    only involved when columns are replaced.
+
+    The row count is the length of the longest column; cells beyond the end of
+    a shorter column have no data. Qt::EditRole falls back to the
+    Qt::DisplayRole column when no dedicated one is set.
+
+    \sa QAbstractTableModel
+*/
+
+namespace {
+
+class StringColumn : public QPyAbstractColumn
+{
+public:
+    explicit StringColumn(const QStringList &values) : m_values(values) {}
+
+    int size() const override { return m_values.size(); }
+
+    QVariant value(int row) const override
+    {
+        const QString &v = m_values.at(row);
+        return v.isNull() ? QVariant() : QVariant(v);
+    }
+
+private:
+    const QStringList m_values;
+};
+
+} // namespace
+
+QPyColumnarTableModel::QPyColumnarTableModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+QPyColumnarTableModel::~QPyColumnarTableModel() = default;
+
+int QPyColumnarTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rowCount;
+}
+
+int QPyColumnarTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_columns.size();
+}
+
+QVariant QPyColumnarTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.column() >= m_columns.size())
+        return QVariant();
+    const QPyAbstractColumn *values = nullptr;
+    for (const RoleColumn &roleColumn : m_columns.at(index.column())) {
+        if (roleColumn.role == role) {
+            values = roleColumn.values.data();
+            break;
+        }
+        if (role == Qt::EditRole && roleColumn.role == Qt::DisplayRole)
+            values = roleColumn.values.data();
+    }
+    if (values == nullptr || index.row() >= values->size())
+        return QVariant();
+    return values->value(index.row());
+}
+
+QVariant QPyColumnarTableModel::headerData(int section, Qt::Orientation orientation,
+                                           int role) const
+{
+    if (orientation == Qt::Horizontal && role == Qt::DisplayRole
+        && section >= 0 && section < m_horizontalHeaderLabels.size()) {
+        return m_horizontalHeaderLabels.at(section);
+    }
+    return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+void QPyColumnarTableModel::setColumn(int column, QPyAbstractColumn *values, int role)
+{
+    replaceColumn(column, role, QSharedPointer<QPyAbstractColumn>(values));
+}
+
+void QPyColumnarTableModel::setColumnStrings(int column, const QStringList &values, int role)
+{
+    replaceColumn(column, role, QSharedPointer<QPyAbstractColumn>(new StringColumn(values)));
+}
+
+void QPyColumnarTableModel::removeColumnRole(int column, int role)
+{
+    if (column >= 0 && column < m_columns.size())
+        replaceColumn(column, role, QSharedPointer<QPyAbstractColumn>());
+}
+
+void QPyColumnarTableModel::setHorizontalHeaderLabels(const QStringList &labels)
+{
+    const int changed = qMax(labels.size(), m_horizontalHeaderLabels.size());
+    m_horizontalHeaderLabels = labels;
+    if (changed > 0)
+        emit headerDataChanged(Qt::Horizontal, 0, changed - 1);
+}
+
+void QPyColumnarTableModel::clear()
+{
+    beginResetModel();
+    m_columns.clear();
+    m_horizontalHeaderLabels.clear();
+    m_rowCount = 0;
+    endResetModel();
+}
+
+void QPyColumnarTableModel::replaceColumn(int column, int role,
+                                          const QSharedPointer<QPyAbstractColumn> &values)
+{
+    if (column < 0) {
+        qWarning("QPyColumnarTableModel: Invalid column %d.", column);
+        return;
+    }
+
+    // Work on a shallow copy so that the previous shape stays visible to the
+    // views until beginResetModel() has been emitted.
+    QVector<RoleColumns> columns = m_columns;
+    if (column >= columns.size())
+        columns.resize(column + 1);
+    RoleColumns &roleColumns = columns[column];
+    auto it = std::find_if(roleColumns.begin(), roleColumns.end(),
+                           [role](const RoleColumn &rc) { return rc.role == role; });
+    if (values.isNull()) {
+        if (it != roleColumns.end())
+            roleColumns.erase(it);
+    } else if (it != roleColumns.end()) {
+        it->values = values;
+    } else {
+        roleColumns.append(RoleColumn{role, values});
+    }
+
+    const int rowCount = computeRowCount(columns);
+    if (rowCount != m_rowCount || columns.size() != m_columns.size()) {
+        beginResetModel();
+        m_columns.swap(columns);
+        m_rowCount = rowCount;
+        endResetModel();
+    } else {
+        m_columns.swap(columns);
+        if (m_rowCount > 0)
+            emit dataChanged(index(0, column), index(m_rowCount - 1, column), {role});
+    }
+}
+
+int QPyColumnarTableModel::computeRowCount(const QVector<RoleColumns> &columns)
+{
+    int result = 0;
+    for (const RoleColumns &roleColumns : columns) {
+        for (const RoleColumn &roleColumn : roleColumns)
+            result = qMax(result, roleColumn.values->size());
+    }
+    return result;
+}
@@ -0,0 +1,96 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QPYCOLUMNARTABLEMODEL_H
+#define QPYCOLUMNARTABLEMODEL_H
+
+#include <QtCore/QAbstractTableModel>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+// Read-only source of the values of one (column, role) pair. Implementations
+// must be readable without holding the GIL since data() is served from C++.
+class QPyAbstractColumn
+{
+public:
+    virtual ~QPyAbstractColumn() = default;
+
+    virtual int size() const = 0;
+    virtual QVariant value(int row) const = 0;
+};
+
+class QPyColumnarTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+public:
+    explicit QPyColumnarTableModel(QObject *parent = nullptr);
+    ~QPyColumnarTableModel() override;
+
+    // Final so that the generated wrapper does not look up Python overrides
+    // for every cell the view asks for.
+    int rowCount(const QModelIndex &parent = QModelIndex()) const final;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const final;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const final;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const final;
+
+    void setColumn(int column, QPyAbstractColumn *values, int role = Qt::DisplayRole);
+    void setColumnStrings(int column, const QStringList &values, int role = Qt::DisplayRole);
+    void removeColumnRole(int column, int role);
+    void setHorizontalHeaderLabels(const QStringList &labels);
+    void clear();
+
+private:
+    struct RoleColumn
+    {
+        int role;
+        QSharedPointer<QPyAbstractColumn> values;
+    };
+    using RoleColumns = QVector<RoleColumn>;
+
+    void replaceColumn(int column, int role, const QSharedPointer<QPyAbstractColumn> &values);
+    static int computeRowCount(const QVector<RoleColumns> &columns);
+
+    QVector<RoleColumns> m_columns;
+    QStringList m_horizontalHeaderLabels;
+    int m_rowCount = 0;
+};
+
+#endif // QPYCOLUMNARTABLEMODEL_H
@@ -122,10 +122,35 @@ macro(create_pyside_module)
         install(FILES ${module_GLUE_SOURCES} DESTINATION share/PySide2${pyside2_SUFFIX}/typesystems/glue)
     endif()
 
+    # Amalgamated wrapper sources written by the generator for unity builds. The
+    # wrappers they include compile to empty translation units on their own.
+    set(unity_build_option "")
+    set(unity_build_sources "")
+    if (PYSIDE_UNITY_BUILD_CHUNKS GREATER 0)
+        set(unity_build_option "--unity-build=${PYSIDE_UNITY_BUILD_CHUNKS}")
+        math(EXPR last_unity_build_chunk "${PYSIDE_UNITY_BUILD_CHUNKS} - 1")
+        foreach(chunk RANGE ${last_unity_build_chunk})
+            list(APPEND unity_build_sources
+                 "${${module_NAME}_GEN_DIR}/${lower_module_name}_unity_${chunk}.cpp")
+        endforeach()
+    endif()
+
+    # Module headers written by PySide2/CMakeLists.txt for parsing the Qt
+    # headers concurrently in several translation units.
+    set(module_global_headers "${pyside2_BINARY_DIR}/${module_NAME}_global.h")
+    set(parser_jobs_option "")
+    if (PYSIDE_PARSER_JOBS GREATER 1)
+        set(parser_jobs_option "--parser-jobs=${PYSIDE_PARSER_JOBS}")
+        math(EXPR last_module_header_group "${PYSIDE_PARSER_JOBS} - 1")
+        foreach(group RANGE 1 ${last_module_header_group})
+            list(APPEND module_global_headers "${pyside2_BINARY_DIR}/${module_NAME}_global_${group}.h")
+        endforeach()
+    endif()
+
     add_custom_command( OUTPUT "${CMAKE_CURRENT_BINARY_DIR}/mjb_rejected_classes.log"
-                        BYPRODUCTS ${${module_SOURCES}}
+                        BYPRODUCTS ${${module_SOURCES}} ${unity_build_sources}
                         COMMAND Shiboken2::shiboken2 ${GENERATOR_EXTRA_FLAGS}
-                        "${pyside2_BINARY_DIR}/${module_NAME}_global.h"
+                        ${module_global_headers}
                         --include-paths=${shiboken_include_dirs}
                         ${shiboken_framework_include_dirs_option}
                         --typesystem-paths=${pyside_binary_dir}${PATH_SEP}${pyside2_SOURCE_DIR}${PATH_SEP}${${module_TYPESYSTEM_PATH}}
@@ -134,6 +159,8 @@ macro(create_pyside_module)
                         ${typesystem_path}
                         --api-version=${SUPPORTED_QT_VERSION}
                         --drop-type-entries="${dropped_entries}"
+                        ${unity_build_option}
+                        ${parser_jobs_option}
                         DEPENDS ${total_type_system_files}
                                 ${module_GLUE_SOURCES}
                                 ${${module_NAME}_glue_dependency}
@@ -142,6 +169,7 @@ macro(create_pyside_module)
 
     include_directories(${module_NAME} ${${module_INCLUDE_DIRS}} ${pyside2_SOURCE_DIR})
     add_library(${module_NAME} MODULE ${${module_SOURCES}}
+                                      ${unity_build_sources}
                                       ${${module_STATIC_SOURCES}})
     set_target_properties(${module_NAME} PROPERTIES
                           PREFIX ""
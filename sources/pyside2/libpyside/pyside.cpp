@@ -63,6 +63,8 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
 #include <QtCore/QFileInfo>
+#include <QtCore/QHash>
+#include <QtCore/QPointer>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QStack>
 
@@ -82,9 +84,28 @@ QT_END_NAMESPACE
 namespace PySide
 {
 
+// C++ objects released by other threads are deleted in the main thread by a
+// single queued call per batch, so that this does not depend on the main
+// thread running Python code. libshiboken additionally adds a Python pending
+// call for the case where the event loop is not running.
+static bool postDeletionInMainThread()
+{
+    QCoreApplication *app = QCoreApplication::instance();
+    if (app == nullptr)
+        return false;
+    QMetaObject::invokeMethod(app, []() {
+        if (!Py_IsInitialized())
+            return;
+        Shiboken::GilState state;
+        Shiboken::BindingManager::instance().runDeletionInMainThread();
+    }, Qt::QueuedConnection);
+    return true;
+}
+
 void init(PyObject *module)
 {
     qobjectNextAddr = 0;
+    Shiboken::BindingManager::instance().setDeletionInMainThreadNotifier(postDeletionInMainThread);
     ClassInfo::init(module);
     Signal::init(module);
     Slot::init(module);
@@ -93,6 +114,9 @@ void init(PyObject *module)
     // Init signal manager, so it will register some meta types used by QVariant.
     SignalManager::instance();
     initQApp();
+    // Teardown visits all live QObjects, keep them indexed for that.
+    Shiboken::BindingManager::instance().indexWrappersOfType(
+        Shiboken::Conversions::getPythonTypeObject("QObject*"));
 }
 
 static bool _setProperty(PyObject *qObj, PyObject *name, PyObject *value, bool *accept)
@@ -199,7 +223,7 @@ void destroyQCoreApplication()
     assert(pyQObjectType);
 
     void *data[2] = {pyQApp, pyQObjectType};
-    bm.visitAllPyObjects(&destructionVisitor, &data);
+    bm.visitPyObjects(pyQObjectType, &destructionVisitor, &data);
 
     // in the end destroy app
     // Allow threads because the destructor calls
@@ -308,6 +332,54 @@ void initQApp()
     setDestroyQApplication(destroyQCoreApplication);
 }
 
+// Named descendants of objects registered by registerChildrenNameAttributes(),
+// keyed by the root object.
+using ChildrenNameIndex = QHash<QByteArray, QPointer<QObject> >;
+static QHash<const QObject *, ChildrenNameIndex> childrenNameIndexes;
+
+static void indexChildrenNames(ChildrenNameIndex &index, const QObject *object)
+{
+    for (QObject *child : object->children()) {
+        const QByteArray name = child->objectName().toLocal8Bit();
+        if (!name.isEmpty() && !name.startsWith('_') && !name.startsWith("qt_")
+            && !index.contains(name)) {
+            index.insert(name, child);
+        }
+        indexChildrenNames(index, child);
+    }
+}
+
+void registerChildrenNameAttributes(QObject *root)
+{
+    ChildrenNameIndex index;
+    indexChildrenNames(index, root);
+    if (index.isEmpty())
+        return;
+    const bool known = childrenNameIndexes.contains(root);
+    childrenNameIndexes.insert(root, index);
+    if (!known)
+        QObject::connect(root, &QObject::destroyed, [root]() { childrenNameIndexes.remove(root); });
+}
+
+// Returns the wrapper of the descendant of \p cppSelf named \p name, if any,
+// and stores it as attribute so that it is found directly next time.
+static PyObject *childNameAttribute(QObject *cppSelf, PyObject *self, PyObject *name,
+                                    const char *cname)
+{
+    auto it = childrenNameIndexes.constFind(cppSelf);
+    if (it == childrenNameIndexes.cend())
+        return nullptr;
+    QObject *child = it.value().value(QByteArray(cname)).data();
+    static SbkConverter *converter = Shiboken::Conversions::getConverter("QObject*");
+    if (!child || !converter)
+        return nullptr;
+    PyErr_Clear();
+    PyObject *pyChild = Shiboken::Conversions::pointerToPython(converter, child);
+    if (pyChild)
+        PyObject_SetAttr(self, name, pyChild);
+    return pyChild;
+}
+
 PyObject *getMetaDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *name)
 {
     PyObject *attr = PyObject_GenericGetAttr(self, name);
@@ -360,6 +432,10 @@ PyObject *getMetaDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *nam
                 PyObject_SetAttr(self, name, pySignal);
                 return pySignal;
             }
+            if (!childrenNameIndexes.isEmpty()) {
+                if (PyObject *pyChild = childNameAttribute(cppSelf, self, name, cname))
+                    return pyChild;
+            }
         }
     }
     return attr;
@@ -127,6 +127,14 @@ PYSIDE_API void destroyQCoreApplication();
  */
 PYSIDE_API PyObject *getMetaDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *name);
 
+/**
+ * Makes the named descendants of \p root accessible as attributes of its
+ * Python wrapper, as done for widgets loaded by QUiLoader. The names are
+ * indexed once; the wrappers of the children are created on first access.
+ * \param root The object whose descendants are indexed
+ */
+PYSIDE_API void registerChildrenNameAttributes(QObject *root);
+
 /**
  * Check if self inherits from class_name
  * \param self Python object
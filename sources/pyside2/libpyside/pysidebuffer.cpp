@@ -0,0 +1,134 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "pysidebuffer.h"
+
+namespace PySide { namespace Buffer {
+
+ItemType itemType(const char *format, Py_ssize_t itemSize)
+{
+    if (format == nullptr)
+        format = "B";
+    switch (*format) {
+    case '@':
+    case '=':
+        ++format;
+        break;
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    case '<':
+        ++format;
+        break;
+#else
+    case '>':
+    case '!':
+        ++format;
+        break;
+#endif
+    default:
+        break;
+    }
+    if (format[0] == '\0' || format[1] != '\0')
+        return ItemType::Invalid;
+
+    const bool isSigned = std::strchr("bhilqn", format[0]) != nullptr;
+    switch (format[0]) {
+    case '?':
+        return itemSize == 1 ? ItemType::Bool : ItemType::Invalid;
+    case 'b':
+    case 'B':
+    case 'h':
+    case 'H':
+    case 'i':
+    case 'I':
+    case 'l':
+    case 'L':
+    case 'q':
+    case 'Q':
+    case 'n':
+    case 'N':
+        switch (itemSize) {
+        case 1:
+            return isSigned ? ItemType::Int8 : ItemType::UInt8;
+        case 2:
+            return isSigned ? ItemType::Int16 : ItemType::UInt16;
+        case 4:
+            return isSigned ? ItemType::Int32 : ItemType::UInt32;
+        case 8:
+            return isSigned ? ItemType::Int64 : ItemType::UInt64;
+        default:
+            break;
+        }
+        break;
+    case 'f':
+        return itemSize == 4 ? ItemType::Float : ItemType::Invalid;
+    case 'd':
+        return itemSize == 8 ? ItemType::Double : ItemType::Invalid;
+    default:
+        break;
+    }
+    return ItemType::Invalid;
+}
+
+ItemType getNumericBuffer(PyObject *obj, int ndim, Py_buffer *view)
+{
+    if (PyBytes_Check(obj) || PyByteArray_Check(obj)) {
+        PyErr_Format(PyExc_TypeError, "Expected a buffer of numbers, got %s.",
+                     Py_TYPE(obj)->tp_name);
+        return ItemType::Invalid;
+    }
+    if (PyObject_GetBuffer(obj, view, PyBUF_RECORDS_RO) != 0)
+        return ItemType::Invalid;
+    const ItemType type = itemType(view->format, view->itemsize);
+    if (type == ItemType::Invalid) {
+        PyErr_Format(PyExc_TypeError, "Expected a buffer of numbers, got format '%s'.",
+                     view->format != nullptr ? view->format : "B");
+        PyBuffer_Release(view);
+        return ItemType::Invalid;
+    }
+    if (view->ndim != ndim) {
+        PyErr_Format(PyExc_ValueError, "Expected a %d-dimensional buffer, got %d dimensions.",
+                     ndim, view->ndim);
+        PyBuffer_Release(view);
+        return ItemType::Invalid;
+    }
+    return type;
+}
+
+} //namespace Buffer
+} //namespace PySide
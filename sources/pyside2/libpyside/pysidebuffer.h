@@ -0,0 +1,130 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef PYSIDEBUFFER_H
+#define PYSIDEBUFFER_H
+
+#include <pysidemacros.h>
+#include <sbkpython.h>
+
+#include <QtCore/qglobal.h>
+
+#include <cstring>
+
+namespace PySide { namespace Buffer {
+
+// Item types of numeric buffers (numpy arrays, array.array...)
+enum class ItemType { Invalid, Bool, Int8, UInt8, Int16, UInt16, Int32, UInt32,
+                      Int64, UInt64, Float, Double };
+
+// Map a PEP 3118 struct format of a single item in native byte order and
+// standard size to an item type.
+PYSIDE_API ItemType itemType(const char *format, Py_ssize_t itemSize);
+
+// Get a buffer of numeric items with \a ndim dimensions from \a obj. Byte
+// strings are rejected. Returns ItemType::Invalid with an exception set on
+// failure; otherwise the view needs to be released by the caller.
+PYSIDE_API ItemType getNumericBuffer(PyObject *obj, int ndim, Py_buffer *view);
+
+template <class Item>
+inline Item readItemAs(const char *data)
+{
+    Item result;
+    std::memcpy(&result, data, sizeof(Item));
+    return result;
+}
+
+template <>
+inline bool readItemAs<bool>(const char *data)
+{
+    return *data != 0;
+}
+
+// Call \a f with a value of the C++ type of the items of \a type, typically a
+// function object whose templated call operator loops over the items with
+// readItemAs<Item>(). The loop is then instantiated for each item type instead
+// of switching on the type per item. Returns false for ItemType::Invalid; does
+// not require the GIL.
+template <class Function>
+inline bool visit(ItemType type, Function &&f)
+{
+    switch (type) {
+    case ItemType::Bool:
+        f(bool());
+        return true;
+    case ItemType::Int8:
+        f(qint8());
+        return true;
+    case ItemType::UInt8:
+        f(quint8());
+        return true;
+    case ItemType::Int16:
+        f(qint16());
+        return true;
+    case ItemType::UInt16:
+        f(quint16());
+        return true;
+    case ItemType::Int32:
+        f(qint32());
+        return true;
+    case ItemType::UInt32:
+        f(quint32());
+        return true;
+    case ItemType::Int64:
+        f(qint64());
+        return true;
+    case ItemType::UInt64:
+        f(quint64());
+        return true;
+    case ItemType::Float:
+        f(float());
+        return true;
+    case ItemType::Double:
+        f(double());
+        return true;
+    case ItemType::Invalid:
+        break;
+    }
+    return false;
+}
+
+} //namespace Buffer
+} //namespace PySide
+
+#endif // PYSIDEBUFFER_H
@@ -49,6 +49,7 @@ extern "C" {
     {
         SbkConverter **converterPtr;
         SbkConverter *converter;
+        PyObject **valueCache;
     };
     /**
      * Type of all QFlags
@@ -80,8 +81,43 @@ extern "C" {
         return reinterpret_cast<PyObject *>(self);
     }
 
+    static bool isQFlagsType(PyTypeObject *type)
+    {
+        return PyType_HasFeature(type, Py_TPFLAGS_HEAPTYPE)
+            && PyType_GetSlot(type, Py_tp_new) == reinterpret_cast<void *>(PySideQFlagsNew);
+    }
+
+    // Reads the value of an int, enum item or QFlags without creating
+    // temporary objects.
+    static bool valueInPlace(PyObject *v, long *value)
+    {
+#ifndef IS_PY3K
+        if (PyInt_Check(v)) {
+            *value = PyInt_AS_LONG(v);
+            return true;
+        }
+#endif
+        if (PyLong_Check(v)) {
+            int overflow;
+            *value = PyLong_AsLongAndOverflow(v, &overflow);
+            return overflow == 0;
+        }
+        if (Shiboken::Enum::check(v)) {
+            *value = Shiboken::Enum::getValue(v);
+            return true;
+        }
+        if (isQFlagsType(Py_TYPE(v))) {
+            *value = PYSIDE_QFLAGS(v)->ob_value;
+            return true;
+        }
+        return false;
+    }
+
     static long getNumberValue(PyObject *v)
     {
+        long value;
+        if (valueInPlace(v, &value))
+            return value;
         Shiboken::AutoDecRef number(PyNumber_Long(v));
         return PyLong_AsLong(number);
     }
@@ -140,6 +176,15 @@ namespace PySide
 {
 namespace QFlags
 {
+    // Number of QFlags instances kept per type for reuse by newObject().
+    static const std::size_t valueCacheSize = 64;
+
+    static inline std::size_t valueCacheIndex(long value)
+    {
+        const auto v = static_cast<unsigned long>(value);
+        return (v ^ (v >> 6) ^ (v >> 12)) % valueCacheSize;
+    }
+
     static PyType_Slot SbkNewQFlagsType_slots[] = {
 #ifdef IS_PY3K
         {Py_nb_bool, 0},
@@ -191,6 +236,7 @@ namespace QFlags
 
         PySideQFlagsType *flagsType = reinterpret_cast<PySideQFlagsType *>(type);
         PepType_PFTP(flagsType)->converterPtr = &PepType_PFTP(flagsType)->converter;
+        PepType_PFTP(flagsType)->valueCache = new PyObject *[valueCacheSize]();
 
         if (PyType_Ready(type) < 0)
             return 0;
@@ -200,8 +246,23 @@ namespace QFlags
 
     PySideQFlagsObject *newObject(long value, PyTypeObject *type)
     {
+        // QFlags instances are immutable, so the objects for the values in
+        // use (typically a handful of flag combinations) can be shared.
+        PyObject **cache = PepType_PFTP(type)->valueCache;
+        PyObject **slot = cache ? &cache[valueCacheIndex(value)] : nullptr;
+        if (slot && *slot && PYSIDE_QFLAGS(*slot)->ob_value == value) {
+            Py_INCREF(*slot);
+            return PYSIDE_QFLAGS(*slot);
+        }
         PySideQFlagsObject *qflags = PyObject_New(PySideQFlagsObject, type);
+        if (!qflags)
+            return nullptr;
         qflags->ob_value = value;
+        if (slot) {
+            Py_XDECREF(*slot);
+            *slot = reinterpret_cast<PyObject *>(qflags);
+            Py_INCREF(*slot);
+        }
         return qflags;
     }
 
@@ -209,5 +270,13 @@ namespace QFlags
     {
         return self->ob_value;
     }
+
+    long getNumberValue(PyObject *number)
+    {
+        long value;
+        if (valueInPlace(number, &value))
+            return value;
+        return PyLong_AsLong(number);
+    }
 }
 }
@@ -72,6 +72,12 @@ namespace QFlags
      * Returns the value held by a QFlag.
      */
     PYSIDE_API long getValue(PySideQFlagsObject* self);
+    /**
+     * Returns the value of \p number, which may be a Python int, an enum
+     * item or a QFlags instance. Other objects are converted with their
+     * __int__ method. Returns -1 and sets an error on failure.
+     */
+    PYSIDE_API long getNumberValue(PyObject *number);
 }
 }
 
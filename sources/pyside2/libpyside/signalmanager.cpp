@@ -55,11 +55,14 @@
 #include <sbkstring.h>
 #include <sbkstaticstrings.h>
 
+#include <QtCore/QAbstractEventDispatcher>
 #include <QtCore/QDebug>
 #include <QtCore/QHash>
+#include <QtCore/QThread>
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 
 // These private headers are needed to throw JavaScript exceptions
 #if PYSIDE_QML_PRIVATE_API_SUPPORT
@@ -380,6 +383,7 @@ bool SignalManager::emitSignal(QObject *source, const char *signal, PyObject *ar
 
 int SignalManager::qt_metacall(QObject *object, QMetaObject::Call call, int id, void **args)
 {
+    beginCallbackBatch();
     const QMetaObject *metaObject = object->metaObject();
     PySideProperty *pp = nullptr;
     PyObject *pp_name = nullptr;
@@ -512,6 +516,40 @@ int SignalManager::qt_metacall(QObject *object, QMetaObject::Call call, int id,
     return id;
 }
 
+// Python callbacks delivered to a thread that was not created by Python (a C++
+// QThread running an event loop) would create and destroy a Python thread state
+// in each GilState. A GIL session keeps it for the burst of events being
+// processed and ends when the event dispatcher is about to block or the
+// thread finishes. The session does not hold the GIL, so that C++ code running
+// between the callbacks does not block Python threads; each callback still
+// takes the GIL in its GilState.
+static thread_local std::unique_ptr<Shiboken::GilSession> threadGilSession;
+static thread_local QAbstractEventDispatcher *threadGilSessionDispatcher = nullptr;
+
+static void endThreadGilSession()
+{
+    threadGilSession.reset();
+}
+
+void SignalManager::beginCallbackBatch()
+{
+    if (threadGilSession || !Py_IsInitialized()
+        || PyGILState_GetThisThreadState() != nullptr) {
+        return; // Python thread or a callback is already running
+    }
+    QAbstractEventDispatcher *dispatcher = QAbstractEventDispatcher::instance();
+    if (dispatcher == nullptr)
+        return; // No event loop that would tell when the batch ends
+    if (dispatcher != threadGilSessionDispatcher) {
+        QObject::connect(dispatcher, &QAbstractEventDispatcher::aboutToBlock,
+                         endThreadGilSession);
+        QObject::connect(QThread::currentThread(), &QThread::finished,
+                         endThreadGilSession);
+        threadGilSessionDispatcher = dispatcher;
+    }
+    threadGilSession.reset(new Shiboken::GilSession);
+}
+
 int SignalManager::callPythonMetaMethod(const QMetaMethod &method, void **args, PyObject *pyMethod, bool isShortCuit)
 {
     Q_ASSERT(pyMethod);
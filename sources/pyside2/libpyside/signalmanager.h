@@ -106,6 +106,11 @@ public:
     // Utility function to call a python method usign args received in qt_metacall
     static int callPythonMetaMethod(const QMetaMethod& method, void** args, PyObject* obj, bool isShortCuit);
 
+    // Keeps the Python thread state of a thread not created by Python until its
+    // event loop goes idle, so that a burst of queued callbacks shares it.
+    // The GIL is not held in between; each callback still takes it.
+    static void beginCallbackBatch();
+
 private:
     struct SignalManagerPrivate;
     SignalManagerPrivate* m_d;
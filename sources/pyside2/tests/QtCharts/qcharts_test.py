@@ -30,6 +30,7 @@
 
 '''Test cases for QCharts'''
 
+import array
 import os
 import sys
 import unittest
@@ -39,9 +40,10 @@ from init_paths import init_test_paths
 init_test_paths(False)
 
 from helper.usesqapplication import UsesQApplication
-from PySide2.QtCore import QRect, QSize, QTimer
+from PySide2.QtCore import QPointF, QRect, QSize, QTimer
 from PySide2.QtGui import QGuiApplication, QScreen
 from PySide2.QtCharts import QtCharts
+import py3kcompat as py3k
 
 class QChartsTestCase(UsesQApplication):
     '''Tests related to QCharts'''
@@ -65,5 +67,43 @@ class QChartsTestCase(UsesQApplication):
         QTimer.singleShot(500, self.app.quit)
         self.app.exec_()
 
+    def testXYSeriesBuffers(self):
+        series = QtCharts.QLineSeries()
+        series.replaceNp(array.array('d', [0, 1, 2]), array.array('i', [10, 20, 30]))
+        self.assertEqual(series.count(), 3)
+        self.assertEqual(series.at(2), QPointF(2, 30))
+        series.appendNp(array.array('f', [3]), array.array('f', [40]))
+        self.assertEqual(series.count(), 4)
+        self.assertEqual(series.at(3), QPointF(3, 40))
+        self.assertRaises(ValueError, series.replaceNp, array.array('d', [0, 1]),
+                          array.array('d', [0]))
+        self.assertRaises(TypeError, series.replaceNp, [0, 1], [0, 1])
+        self.assertEqual(series.count(), 4)
+
+    @unittest.skipUnless(py3k.IS_PY3K, "memoryview.cast() requires Python 3")
+    def testXYSeriesPointBuffer(self):
+        series = QtCharts.QScatterSeries()
+        points = memoryview(array.array('d', [0, 1, 2, 3])).cast('B').cast('d', [2, 2])
+        series.replaceNp(points)
+        self.assertEqual(series.pointsVector(), [QPointF(0, 1), QPointF(2, 3)])
+        series.appendNp(points)
+        self.assertEqual(series.count(), 4)
+
+    def testXYSeriesAppendSignals(self):
+        series = QtCharts.QLineSeries()
+        added = []
+        replaced = []
+        series.pointAdded.connect(added.append)
+        series.pointsReplaced.connect(lambda: replaced.append(True))
+        values = array.array('d', range(1000))
+        series.appendNp(values, values)
+        series.appendNp(values, values)
+        self.assertEqual(series.count(), 2000)
+        self.assertEqual(series.at(1999), QPointF(999, 999))
+        # append() notifies each added point
+        self.assertEqual(len(added), 2000)
+        self.assertEqual(added[-1], 1999)
+        self.assertEqual(replaced, [])
+
 if __name__ == '__main__':
     unittest.main()
@@ -109,6 +109,20 @@ class QFlagOperatorTest(unittest.TestCase):
         flags = Qt.NoItemFlags | Qt.ItemIsUserCheckable
         self.assertEqual(flags | Qt.ItemIsEnabled, Qt.ItemIsEnabled | flags)
 
+    def testRepeatedOperations(self):
+        '''Shared QFlags results keep their own values'''
+        for i in range(3):
+            alignment = Qt.AlignLeft | Qt.AlignTop
+            self.assertEqual(type(alignment), Qt.Alignment)
+            self.assertEqual(int(alignment), int(Qt.AlignLeft) | int(Qt.AlignTop))
+            other = alignment | Qt.AlignHCenter
+            self.assertEqual(int(alignment), int(Qt.AlignLeft) | int(Qt.AlignTop))
+            self.assertEqual(int(other & Qt.AlignHorizontal_Mask), int(Qt.AlignLeft | Qt.AlignHCenter))
+            self.assertTrue(alignment & Qt.AlignTop)
+            self.assertFalse(alignment & Qt.AlignBottom)
+            self.assertTrue(alignment == int(alignment))
+            self.assertTrue(Qt.AlignTop < Qt.AlignBottom)
+
 class QFlagsOnQVariant(unittest.TestCase):
     def testQFlagsOnQVariant(self):
         o = QObject()
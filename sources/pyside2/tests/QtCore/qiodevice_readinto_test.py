@@ -0,0 +1,78 @@
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for QIODevice.readInto'''
+
+import os
+import sys
+import unittest
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide2.QtCore import QBuffer, QByteArray, QIODevice
+import py3kcompat as py3k
+
+
+class QIODeviceReadIntoTest(unittest.TestCase):
+
+    def setUp(self):
+        self.data = py3k.b('binary\x00data\x00with\x00zeros')
+        self.device = QBuffer()
+        self.device.setData(QByteArray(self.data))
+        self.assertTrue(self.device.open(QIODevice.ReadOnly))
+
+    def tearDown(self):
+        self.device.close()
+
+    def testReadIntoBytearray(self):
+        buffer = bytearray(len(self.data) + 10)
+        size = self.device.readInto(buffer)
+        self.assertEqual(size, len(self.data))
+        self.assertEqual(bytes(buffer[:size]), self.data)
+
+    def testReadIntoMaxSize(self):
+        buffer = bytearray(32)
+        self.assertEqual(self.device.readInto(buffer, 6), 6)
+        self.assertEqual(bytes(buffer[:6]), py3k.b('binary'))
+        self.assertEqual(self.device.pos(), 6)
+
+    def testReadIntoMemoryview(self):
+        buffer = bytearray(len(self.data))
+        view = memoryview(buffer)[4:]
+        size = self.device.readInto(view)
+        self.assertEqual(size, len(self.data) - 4)
+        self.assertEqual(bytes(buffer[4:]), self.data[:size])
+
+    def testReadIntoReadOnlyBuffer(self):
+        self.assertRaises(BufferError, self.device.readInto, py3k.b('readonly'))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -58,6 +58,38 @@ class QJsonDocumentTest(unittest.TestCase):
         else:
             self.assertEqual(str(b.toVariant()), "{u'test': [None]}")
 
+    def testToPython(self):
+        a = QJsonDocument.fromJson(b'{"a": [1, 2.5, true, null, "x", {"b": {}}], "c": "d"}')
+        self.assertEqual(a.toPython(), {'a': [1.0, 2.5, True, None, 'x', {'b': {}}], 'c': 'd'})
+        self.assertEqual(a.object(), a.toPython())
+
+        b = QJsonDocument.fromJson(b'[[], {}, -3]')
+        self.assertEqual(b.toPython(), [[], {}, -3.0])
+
+        self.assertEqual(QJsonDocument().toPython(), None)
+
+    def testFromDict(self):
+        data = {'a': [1, 2.5, True, None, 'x', (3, 4)], 'b': {'c': 'd'}}
+        a = QJsonDocument(data)
+        self.assertTrue(a.isObject())
+        self.assertEqual(a.toPython(), {'a': [1, 2.5, True, None, 'x', [3, 4]], 'b': {'c': 'd'}})
+
+    def testFromDictErrors(self):
+        self.assertRaises(TypeError, QJsonDocument, {1: 'a'})
+        self.assertRaises(TypeError, QJsonDocument, {'a': [{'b': {2: 'c'}}]})
+        self.assertEqual(QJsonDocument({'a': 2 ** 70}).toPython(), {'a': float(2 ** 70)})
+        self.assertRaises(OverflowError, QJsonDocument, {'a': [10 ** 400]})
+
+    def testFromDictRecursion(self):
+        # Python 2 raises the RuntimeError base class
+        error = RecursionError if py3k.IS_PY3K else RuntimeError
+        data = {'a': []}
+        data['a'].append(data)
+        self.assertRaises(error, QJsonDocument, data)
+        nested = []
+        nested.append(nested)
+        self.assertRaises(error, QJsonDocument, {'a': nested})
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,117 @@
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for QPyColumnarTableModel'''
+
+import array
+import os
+import sys
+import unittest
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide2.QtCore import QAbstractTableModel, QPyColumnarTableModel, Qt
+
+
+class QPyColumnarTableModelTest(unittest.TestCase):
+
+    def setUp(self):
+        self.model = QPyColumnarTableModel()
+
+    def tearDown(self):
+        del self.model
+
+    def testIsTableModel(self):
+        self.assertTrue(isinstance(self.model, QAbstractTableModel))
+        self.assertEqual(self.model.rowCount(), 0)
+        self.assertEqual(self.model.columnCount(), 0)
+
+    def testNumericBuffers(self):
+        self.model.setColumn(0, array.array('i', [1, -2, 3]))
+        self.model.setColumn(1, array.array('d', [0.5, 1.5]))
+        self.assertEqual(self.model.rowCount(), 3)
+        self.assertEqual(self.model.columnCount(), 2)
+        self.assertEqual(self.model.index(1, 0).data(), -2)
+        self.assertEqual(self.model.index(1, 1).data(), 1.5)
+        # Shorter columns leave the remaining cells empty
+        self.assertEqual(self.model.index(2, 1).data(), None)
+        # EditRole falls back to DisplayRole
+        self.assertEqual(self.model.index(0, 0).data(Qt.EditRole), 1)
+
+    def testBufferIsReferenced(self):
+        values = array.array('H', [10, 20])
+        self.model.setColumn(0, values)
+        values[1] = 42
+        self.assertEqual(self.model.index(1, 0).data(), 42)
+        # The buffer is exported as long as the column exists
+        self.assertRaises(BufferError, values.append, 1)
+        self.model.setColumn(0, None)
+        values.append(1)
+
+    def testStrings(self):
+        self.model.setColumn(0, ['a', None, 'c'])
+        self.model.setColumn(0, ('tip',), Qt.ToolTipRole)
+        self.assertEqual(self.model.index(0, 0).data(), 'a')
+        self.assertEqual(self.model.index(1, 0).data(), None)
+        self.assertEqual(self.model.index(0, 0).data(Qt.ToolTipRole), 'tip')
+        self.assertEqual(self.model.index(2, 0).data(Qt.ToolTipRole), None)
+
+    def testInvalidValues(self):
+        self.assertRaises(TypeError, self.model.setColumn, 0, 'abc')
+        self.assertRaises(TypeError, self.model.setColumn, 0, 42)
+        # Byte strings are not numeric columns
+        self.assertRaises(TypeError, self.model.setColumn, 0, bytearray(b'abc'))
+        # Buffers of other items are not converted to strings
+        self.assertRaises(TypeError, self.model.setColumn, 0, array.array('u', 'abc'))
+        self.assertEqual(self.model.columnCount(), 0)
+
+    def testHeaderLabels(self):
+        self.model.setColumn(0, array.array('b', [1]))
+        self.model.setHorizontalHeaderLabels(['Value'])
+        self.assertEqual(self.model.headerData(0, Qt.Horizontal), 'Value')
+
+    def testSignals(self):
+        resets = []
+        changes = []
+        self.model.modelReset.connect(lambda: resets.append(True))
+        self.model.dataChanged.connect(lambda tl, br, roles: changes.append(list(roles)))
+        self.model.setColumn(0, array.array('i', [1, 2]))
+        self.assertEqual(len(resets), 1)
+        # Same shape: only the column is reported as changed
+        self.model.setColumn(0, array.array('i', [3, 4]))
+        self.assertEqual(len(resets), 1)
+        self.assertEqual(changes, [[Qt.DisplayRole]])
+        self.model.clear()
+        self.assertEqual(len(resets), 2)
+        self.assertEqual(self.model.rowCount(), 0)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -30,6 +30,7 @@
 
 '''Test cases for QtDataVisualization'''
 
+import array
 import os
 import sys
 import unittest
@@ -41,6 +42,10 @@ init_test_paths(False)
 from helper.usesqguiapplication import UsesQGuiApplication
 from PySide2.QtCore import QTimer
 from PySide2.QtDataVisualization import QtDataVisualization
+import py3kcompat as py3k
+
+def floatBuffer(typecode, values, shape):
+    return memoryview(array.array(typecode, values)).cast('B').cast(typecode, shape)
 
 def dataToBarDataRow(data):
     result = []
@@ -88,5 +93,34 @@ class QtDataVisualizationTestCase(UsesQGuiApplication):
         QTimer.singleShot(500, self.app.quit)
         self.app.exec_()
 
+    @unittest.skipUnless(py3k.IS_PY3K, "memoryview.cast() requires Python 3")
+    def testSurfaceHeightBuffer(self):
+        proxy = QtDataVisualization.QSurfaceDataProxy()
+        heights = floatBuffer('f', [0, 1, 2, 3, 4, 5], [2, 3])
+        proxy.resetArrayNp(10, 0.5, 20, 2, heights)
+        self.assertEqual(proxy.rowCount(), 2)
+        self.assertEqual(proxy.columnCount(), 3)
+        position = proxy.itemAt(1, 2).position()
+        self.assertEqual((position.x(), position.y(), position.z()), (11, 5, 22))
+
+    @unittest.skipUnless(py3k.IS_PY3K, "memoryview.cast() requires Python 3")
+    def testSurfacePositionBuffer(self):
+        proxy = QtDataVisualization.QSurfaceDataProxy()
+        positions = floatBuffer('d', range(12), [2, 2, 3])
+        proxy.resetArrayNp(positions)
+        self.assertEqual(proxy.rowCount(), 2)
+        self.assertEqual(proxy.columnCount(), 2)
+        position = proxy.itemAt(1, 0).position()
+        self.assertEqual((position.x(), position.y(), position.z()), (6, 7, 8))
+        self.assertRaises(ValueError, proxy.resetArrayNp, floatBuffer('d', range(8), [2, 2, 2]))
+        self.assertRaises(TypeError, proxy.resetArrayNp, floatBuffer('i', range(12), [2, 2, 3]))
+
+    @unittest.skipUnless(py3k.IS_PY3K, "memoryview.cast() requires Python 3")
+    def testBarValueBuffer(self):
+        proxy = QtDataVisualization.QBarDataProxy()
+        proxy.resetArrayNp(floatBuffer('f', [1, 2, 3, 4], [2, 2]))
+        self.assertEqual(proxy.rowCount(), 2)
+        self.assertEqual(proxy.itemAt(1, 0).value(), 3)
+
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,158 @@
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for the QImage buffer protocol and wrapping buffers without copying'''
+
+import gc
+import os
+import sys
+import unittest
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from helper.usesqapplication import UsesQApplication
+from PySide2.QtCore import QBuffer, QByteArray, QIODevice, QSize, Qt
+from PySide2.QtGui import QColor, QImage
+
+try:
+    import numpy as np
+    have_numpy = True
+except ImportError:
+    have_numpy = False
+
+
+class QImageBufferExportTest(UsesQApplication):
+
+    def testShapeAndStrides(self):
+        image = QImage(QSize(5, 3), QImage.Format_RGB888)
+        view = memoryview(image)
+        self.assertEqual(view.shape, (3, 5, 3))
+        self.assertEqual(view.strides, (image.bytesPerLine(), 3, 1))
+        self.assertEqual(view.format, 'B')
+        self.assertFalse(view.readonly)
+
+    def testGrayscale(self):
+        image = QImage(QSize(4, 2), QImage.Format_Grayscale8)
+        image.fill(7)
+        view = memoryview(image)
+        self.assertEqual(view.shape, (2, 4))
+        self.assertEqual(view[1, 3], 7)
+
+    def testKeepsImageAlive(self):
+        image = QImage(QSize(8, 8), QImage.Format_ARGB32)
+        image.fill(QColor(Qt.red))
+        view = memoryview(image)
+        del image
+        gc.collect()
+        self.assertEqual(view.shape, (8, 8, 4))
+        # Native endian 0xAARRGGBB
+        self.assertEqual(view.cast('B').tobytes()[:4], QColor(Qt.red).rgba().to_bytes(4, sys.byteorder))
+
+    def testViewSurvivesSwap(self):
+        image = QImage(QSize(4, 4), QImage.Format_Grayscale8)
+        image.fill(42)
+        view = memoryview(image)
+        other = QImage(QSize(2, 2), QImage.Format_Grayscale8)
+        other.fill(7)
+        image.swap(other)
+        del other
+        gc.collect()
+        self.assertEqual(view.shape, (4, 4))
+        self.assertEqual(view.tobytes(), b'\x2a' * 16)
+
+    def testViewSurvivesLoadFromData(self):
+        image = QImage(QSize(4, 4), QImage.Format_Grayscale8)
+        image.fill(42)
+        view = memoryview(image)
+        self.assertTrue(image.loadFromData(self._pngData()))
+        gc.collect()
+        self.assertEqual(image.size(), QSize(2, 3))
+        self.assertEqual(view.tobytes(), b'\x2a' * 16)
+
+    def _pngData(self):
+        source = QImage(QSize(2, 3), QImage.Format_RGB32)
+        source.fill(QColor(Qt.blue))
+        data = QByteArray()
+        buffer = QBuffer(data)
+        buffer.open(QIODevice.WriteOnly)
+        source.save(buffer, 'PNG')
+        buffer.close()
+        return data
+
+    def testPaddedNotContiguous(self):
+        # 3 bytes per line padded to 4
+        image = QImage(QSize(3, 2), QImage.Format_Grayscale8)
+        view = memoryview(image)
+        self.assertEqual(view.strides, (4, 1))
+        self.assertFalse(view.c_contiguous)
+
+    def testMonoNotExportable(self):
+        image = QImage(QSize(8, 8), QImage.Format_Mono)
+        self.assertRaises(BufferError, memoryview, image)
+
+    @unittest.skipUnless(have_numpy, "requires numpy")
+    def testNumpyWritable(self):
+        image = QImage(QSize(6, 4), QImage.Format_RGBA8888)
+        image.fill(QColor(0, 0, 0, 255))
+        array = np.asarray(image)
+        self.assertEqual(array.shape, (4, 6, 4))
+        array[2, 3] = (255, 0, 0, 255)
+        self.assertEqual(image.pixelColor(3, 2), QColor(255, 0, 0, 255))
+
+
+class QImageWrapBufferTest(UsesQApplication):
+
+    def testWrapBytearray(self):
+        data = bytearray(4 * 4 * 4)
+        image = QImage(data, 4, 4, QImage.Format_RGBA8888)
+        data[0:4] = b'\xff\x00\x00\xff'
+        self.assertEqual(image.pixelColor(0, 0), QColor(255, 0, 0, 255))
+
+    def testBufferKeptAlive(self):
+        image = QImage(bytearray(b'\x10' * 16), 4, 4, QImage.Format_Grayscale8)
+        gc.collect()
+        self.assertEqual(image.pixelColor(3, 3), QColor(0x10, 0x10, 0x10))
+
+    def testNonBufferGivesNullImage(self):
+        # Python 3 str does not support the buffer protocol
+        if sys.version_info[0] >= 3:
+            self.assertTrue(QImage('', 4, 4, QImage.Format_Grayscale8).isNull())
+
+    @unittest.skipUnless(have_numpy, "requires numpy")
+    def testNumpyRoundTrip(self):
+        array = np.zeros((3, 5), dtype=np.uint8)
+        image = QImage(array, 5, 3, 5, QImage.Format_Grayscale8)
+        array[1, 2] = 200
+        self.assertEqual(image.pixelColor(2, 1), QColor(200, 200, 200))
+        self.assertTrue(np.array_equal(np.asarray(image), array))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -81,5 +81,50 @@ class HttpSignalsCase(unittest.TestCase):
 
         self.assertTrue(self.called)
 
+class ReadDatagramIntoCase(unittest.TestCase):
+    '''Zero-copy and batched datagram reading'''
+
+    def setUp(self):
+        self.app = QCoreApplication.instance() or QCoreApplication([])
+        self.socket = QUdpSocket()
+        self.server = QUdpSocket()
+        self.address = QHostAddress(QHostAddress.LocalHost)
+        self.assertTrue(self.server.bind(self.address, 0))
+
+    def tearDown(self):
+        del self.socket
+        del self.server
+
+    def send(self, payloads):
+        for payload in payloads:
+            self.socket.writeDatagram(payload, self.address, self.server.localPort())
+        for i in range(10):
+            if self.server.hasPendingDatagrams():
+                break
+            self.server.waitForReadyRead(1000)
+
+    def testReadDatagramInto(self):
+        self.send([py3k.b('data\x00gram')])
+        buffer = bytearray(64)
+        size, host, port = self.server.readDatagramInto(buffer)
+        self.assertEqual(size, 9)
+        self.assertEqual(bytes(buffer[:size]), py3k.b('data\x00gram'))
+        self.assertEqual(port, self.socket.localPort())
+
+    def testReadDatagramIntoReadOnly(self):
+        self.assertRaises(BufferError, self.server.readDatagramInto, py3k.b('readonly'))
+
+    def testReadDatagrams(self):
+        payloads = [py3k.b('first'), py3k.b('second'), py3k.b('third')]
+        self.send(payloads)
+        received = []
+        for i in range(10):
+            received += [data for data, host, port in self.server.readDatagrams(2)]
+            if len(received) == len(payloads):
+                break
+            self.server.waitForReadyRead(1000)
+        self.assertEqual([bytes(data) for data in received], payloads)
+
+
 if __name__ == '__main__':
     unittest.main()
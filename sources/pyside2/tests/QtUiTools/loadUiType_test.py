@@ -28,7 +28,9 @@
 
 import os
 import sys
+import tempfile
 import unittest
+import uuid
 
 sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 from init_paths import init_test_paths
@@ -36,6 +38,7 @@ init_test_paths(False)
 
 from helper.usesqapplication import UsesQApplication
 
+from PySide2.QtCore import QStandardPaths
 from PySide2.QtWidgets import QWidget, QFrame, QPushButton
 from PySide2.QtUiTools import loadUiType
 
@@ -69,6 +72,40 @@ class loadUiTypeTester(UsesQApplication):
         self.assertTrue(isinstance(ui.child_object, QFrame))
         self.assertTrue(isinstance(ui.grandson_object, QPushButton))
 
+    def testCachedResult(self):
+        filePath = os.path.join(os.path.dirname(__file__), "minimal.ui")
+        generated, base = loadUiType(filePath)
+        # Loading the same form again returns the classes created before
+        generatedAgain, baseAgain = loadUiType(filePath)
+        self.assertIs(generatedAgain, generated)
+        self.assertIs(baseAgain, base)
+
+    def testDiskCacheDisabled(self):
+        cacheDir = os.path.join(QStandardPaths.writableLocation(QStandardPaths.GenericCacheLocation),
+                                "pyside2-uic")
+        def cacheEntries():
+            return set(os.listdir(cacheDir)) if os.path.isdir(cacheDir) else set()
+        # Unique contents, so that neither cache has the form yet
+        uiContents = ('<?xml version="1.0" encoding="UTF-8"?>\n'
+                      '<!-- {} -->\n'
+                      '<ui version="4.0">\n'
+                      ' <class>Form</class>\n'
+                      ' <widget class="QFrame" name="Form">\n'
+                      ' </widget>\n'
+                      '</ui>\n').format(uuid.uuid4())
+        fd, filePath = tempfile.mkstemp(suffix=".ui")
+        with os.fdopen(fd, "w") as uiFile:
+            uiFile.write(uiContents)
+        entries = cacheEntries()
+        os.environ["PYSIDE_DISABLE_UIC_CACHE"] = "1"
+        try:
+            generated, base = loadUiType(filePath)
+        finally:
+            del os.environ["PYSIDE_DISABLE_UIC_CACHE"]
+            os.remove(filePath)
+        self.assertTrue("retranslateUi" in dir(generated))
+        self.assertEqual(cacheEntries(), entries)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -67,6 +67,16 @@ class QUiLoaderTester(UsesQApplication):
         self.assertEqual(w.findChild(QWidget, "grandson_object"), child.findChild(QWidget, "grandson_object"))
 
 
+    def testChildNameAttributes(self):
+        loader = QUiLoader()
+        w = loader.load(self._filePath)
+        self.assertNotIn('child_object', w.__dict__)
+        child = w.child_object
+        self.assertEqual(child, w.findChild(QWidget, "child_object"))
+        self.assertIn('child_object', w.__dict__)
+        self.assertEqual(w.grandson_object, child.findChild(QWidget, "grandson_object"))
+        self.assertRaises(AttributeError, getattr, w, 'no_such_child')
+
     def testLoadFileOverride(self):
         # PYSIDE-1070, override QUiLoader::createWidget() with parent=None crashes
         loader = OverridingLoader()
@@ -219,6 +219,24 @@ class TestGraphicsGroup(UsesQApplication):
            QApplication.instance().processEvents()
         view.hide()
 
+class Clear(UsesQApplication):
+    def testClear(self):
+        scene = QGraphicsScene()
+        for i in range(100):
+            QGraphicsRectItem(0, 0, i, i, scene.addRect(0, 0, 1, 1))
+        top = scene.addEllipse(0, 0, 10, 10)
+        child = QGraphicsRectItem(top)
+        other = QGraphicsScene()
+        kept = other.addRect(0, 0, 5, 5)
+        self.assertEqual(len(scene.items()), 202)
+
+        scene.clear()
+        self.assertEqual(scene.items(), [])
+        self.assertRaises(RuntimeError, top.type)
+        self.assertRaises(RuntimeError, child.type)
+        self.assertEqual(kept.scene(), other)
+        self.assertEqual(scene.addLine(0, 0, 1, 1).scene(), scene)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -90,5 +90,17 @@ class QListWidgetTest(UsesQApplication):
         self.assertIsNone(lst.clear())
         self.assertRaises(RuntimeError, lambda: item.text())
 
+    def testClearItemsWithoutReference(self):
+        lst = QtWidgets.QListWidget()
+        for i in range(100):
+            QtWidgets.QListWidgetItem('item {}'.format(i), lst)
+        item = lst.item(50)
+        self.assertEqual(lst.count(), 100)
+        lst.clear()
+        self.assertEqual(lst.count(), 0)
+        self.assertRaises(RuntimeError, item.text)
+        lst.addItem('new')
+        self.assertEqual(lst.item(0).text(), 'new')
+
 if __name__ == '__main__':
     unittest.main()
@@ -34,7 +34,7 @@ sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 from init_paths import init_test_paths
 init_test_paths(False)
 
-from PySide2.QtWidgets import QMenu
+from PySide2.QtWidgets import QAction, QMenu, QToolBar
 from PySide2.QtGui import QKeySequence, QIcon
 from PySide2.QtCore import SLOT
 
@@ -63,6 +63,29 @@ class QMenuAddAction(UsesQApplication):
         action = self.menu.addAction('Quit', self.app, SLOT('quit()'),
                                     QKeySequence('Ctrl+O'))
 
+class QMenuClear(UsesQApplication):
+
+    def testClear(self):
+        menu = QMenu()
+        owned = menu.addAction('owned')
+        shared = menu.addAction('shared')
+        toolBar = QToolBar()
+        toolBar.addAction(shared)
+        owner = QMenu()
+        foreign = QAction('foreign', owner)
+        menu.addAction(foreign)
+
+        menu.clear()
+        self.assertEqual(menu.actions(), [])
+        # Deleted by clear()
+        self.assertRaises(RuntimeError, owned.text)
+        # Still used by the tool bar, respectively owned by another object
+        self.assertEqual(shared.text(), 'shared')
+        self.assertEqual(toolBar.actions(), [shared])
+        self.assertEqual(foreign.text(), 'foreign')
+        self.assertEqual(foreign.parent(), owner)
+
+
 class QMenuAddActionWithIcon(UsesQApplication):
 
     def setUp(self):
@@ -66,5 +66,24 @@ class QTreeWidgetTest(UsesQApplication):
         w = treeWidget.itemWidget(treeWidget.itemAt(0,0), 0)
         self.assertIsInstance(w, QPushButton)
 
+    def testClear(self):
+        treeWidget = QTreeWidget()
+        # The header item is a child of the tree widget, too, but must
+        # survive clear().
+        treeWidget.setHeaderItem(QTreeWidgetItem(['Header']))
+        # PYSIDE-1251: Items without a Python reference are released
+        # while the others are still being processed.
+        for i in range(100):
+            item = QTreeWidgetItem(treeWidget, ['item {}'.format(i)])
+            QTreeWidgetItem(item, ['child'])
+        self.assertEqual(treeWidget.topLevelItemCount(), 100)
+
+        treeWidget.clear()
+        self.assertEqual(treeWidget.topLevelItemCount(), 0)
+        self.assertEqual(treeWidget.headerItem().text(0), 'Header')
+
+        QTreeWidgetItem(treeWidget, ['new'])
+        self.assertEqual(treeWidget.topLevelItem(0).text(0), 'new')
+
 if __name__ == '__main__':
     unittest.main()
@@ -51,6 +51,8 @@
 
 #include <cstdio>
 #include <algorithm>
+#include <memory>
+#include <vector>
 #include "graph.h"
 #include <QTemporaryFile>
 
@@ -404,26 +406,58 @@ void AbstractMetaBuilderPrivate::sortLists()
         cls->sortFunctions();
 }
 
-FileModelItem AbstractMetaBuilderPrivate::buildDom(QByteArrayList arguments,
+FileModelItem AbstractMetaBuilderPrivate::buildDom(QVector<QByteArrayList> argumentGroups,
                                                    LanguageLevel level,
                                                    unsigned clangFlags)
 {
-    clang::Builder builder;
-    builder.setSystemIncludes(TypeDatabase::instance()->systemIncludes());
     if (level == LanguageLevel::Default)
         level = clang::emulatedCompilerLanguageLevel();
-    arguments.prepend(QByteArrayLiteral("-std=")
-                      + clang::languageLevelOption(level));
-    FileModelItem result = clang::parse(arguments, clangFlags, builder)
-        ? builder.dom() : FileModelItem();
-    const clang::BaseVisitor::Diagnostics &diagnostics = builder.diagnostics();
+    const QByteArray languageLevelOption = QByteArrayLiteral("-std=")
+        + clang::languageLevelOption(level);
+    const QByteArrayList &systemIncludes = TypeDatabase::instance()->systemIncludes();
+
+    // One builder per group, each parsed in a separate translation unit
+    std::vector<std::unique_ptr<clang::Builder> > builders;
+    QVector<clang::BaseVisitor *> visitors;
+    for (QByteArrayList &arguments : argumentGroups) {
+        arguments.prepend(languageLevelOption);
+        builders.emplace_back(new clang::Builder);
+        builders.back()->setSystemIncludes(systemIncludes);
+        visitors.append(builders.back().get());
+    }
+
+    FileModelItem result;
+    if (clang::parse(argumentGroups, clangFlags, visitors)) {
+        result = builders.front()->dom();
+        for (size_t i = 1; i < builders.size(); ++i)
+            result->mergeFile(*builders.at(i)->dom());
+    }
+    // Headers included by several groups produce the same diagnostics in
+    // each of them, report those once.
+    QStringList diagnostics;
+    QSet<QString> seenDiagnostics;
+    for (const auto &builder : builders) {
+        for (const clang::Diagnostic &diagnostic : builder->diagnostics()) {
+            QString message;
+            {
+                QDebug d(&message);
+                d.nospace();
+                d.noquote();
+                d << diagnostic;
+            }
+            if (!seenDiagnostics.contains(message)) {
+                seenDiagnostics.insert(message);
+                diagnostics.append(message);
+            }
+        }
+    }
     if (const int diagnosticsCount = diagnostics.size()) {
         QDebug d = qWarning();
         d.nospace();
         d.noquote();
         d << "Clang: " << diagnosticsCount << " diagnostic messages:\n";
-        for (int i = 0; i < diagnosticsCount; ++i)
-            d << "  " << diagnostics.at(i) << '\n';
+        for (const QString &diagnostic : qAsConst(diagnostics))
+            d << "  " << diagnostic << '\n';
     }
     return result;
 }
@@ -692,7 +726,14 @@ bool AbstractMetaBuilder::build(const QByteArrayList &arguments,
                                 LanguageLevel level,
                                 unsigned clangFlags)
 {
-    const FileModelItem dom = d->buildDom(arguments, level, clangFlags);
+    return build(QVector<QByteArrayList>{arguments}, level, clangFlags);
+}
+
+bool AbstractMetaBuilder::build(const QVector<QByteArrayList> &argumentGroups,
+                                LanguageLevel level,
+                                unsigned clangFlags)
+{
+    const FileModelItem dom = d->buildDom(argumentGroups, level, clangFlags);
     if (dom.isNull())
         return false;
     if (ReportHandler::isDebug(ReportHandler::MediumDebug))
@@ -80,6 +80,10 @@ public:
     bool build(const QByteArrayList &arguments,
                LanguageLevel level = LanguageLevel::Default,
                unsigned clangFlags = 0);
+    // Parse several groups of headers concurrently and merge the code models
+    bool build(const QVector<QByteArrayList> &argumentGroups,
+               LanguageLevel level = LanguageLevel::Default,
+               unsigned clangFlags = 0);
     void setLogDirectory(const QString& logDir);
 
     /**
@@ -57,7 +57,7 @@ public:
     AbstractMetaBuilderPrivate();
     ~AbstractMetaBuilderPrivate();
 
-    static FileModelItem buildDom(QByteArrayList arguments,
+    static FileModelItem buildDom(QVector<QByteArrayList> argumentGroups,
                                   LanguageLevel level,
                                   unsigned clangFlags);
     void traverseDom(const FileModelItem &dom);
@@ -35,6 +35,8 @@
 #include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <memory>
+#include <vector>
 
 #include "reporthandler.h"
 #include "typesystem.h"
@@ -200,24 +202,32 @@ bool ApiExtractor::run(bool usePySideExtensions)
         return false;
     }
 
+    // Split the headers into contiguous groups, each of which is included
+    // by a temporary file parsed as a separate translation unit.
+    const int groupCount = qBound(1, m_parserJobs, m_cppFileNames.size());
     const QString pattern = QDir::tempPath() + QLatin1Char('/')
         + m_cppFileNames.constFirst().baseName()
         + QStringLiteral("_XXXXXX.hpp");
-    QTemporaryFile ppFile(pattern);
+    std::vector<std::unique_ptr<QTemporaryFile> > ppFiles;
     bool autoRemove = !qEnvironmentVariableIsSet("KEEP_TEMP_FILES");
-    // make sure that a tempfile can be written
-    if (!ppFile.open()) {
-        std::cerr << "could not create tempfile " << qPrintable(pattern)
-            << ": " << qPrintable(ppFile.errorString()) << '\n';
-        return false;
-    }
-    for (const auto &cppFileName : qAsConst(m_cppFileNames)) {
-        ppFile.write("#include \"");
-        ppFile.write(cppFileName.absoluteFilePath().toLocal8Bit());
-        ppFile.write("\"\n");
+    for (int g = 0; g < groupCount; ++g) {
+        ppFiles.emplace_back(new QTemporaryFile(pattern));
+        QTemporaryFile &ppFile = *ppFiles.back();
+        // make sure that a tempfile can be written
+        if (!ppFile.open()) {
+            std::cerr << "could not create tempfile " << qPrintable(pattern)
+                << ": " << qPrintable(ppFile.errorString()) << '\n';
+            return false;
+        }
+        const int begin = g * m_cppFileNames.size() / groupCount;
+        const int end = (g + 1) * m_cppFileNames.size() / groupCount;
+        for (int i = begin; i < end; ++i) {
+            ppFile.write("#include \"");
+            ppFile.write(m_cppFileNames.at(i).absoluteFilePath().toLocal8Bit());
+            ppFile.write("\"\n");
+        }
+        ppFile.close();
     }
-    const QString preprocessedCppFileName = ppFile.fileName();
-    ppFile.close();
     m_builder = new AbstractMetaBuilder;
     m_builder->setLogDirectory(m_logDirectory);
     m_builder->setGlobalHeaders(m_cppFileNames);
@@ -229,22 +239,30 @@ bool ApiExtractor::run(bool usePySideExtensions)
         arguments.append(HeaderPath::includeOption(headerPath));
     for (const QString &extraCompilerFlag: qAsConst(m_extraCompilerFlags))
         arguments.append(QFile::encodeName(extraCompilerFlag));
-    arguments.append(QFile::encodeName(preprocessedCppFileName));
-    if (ReportHandler::isDebug(ReportHandler::SparseDebug)) {
-        qCInfo(lcShiboken).noquote().nospace()
-            << "clang language level: " << int(m_languageLevel)
-            << "\nclang arguments: " << arguments;
-    }
 
-    if (usePySideExtensions)
-        addPySideExtensions(&arguments);
+    QVector<QByteArrayList> argumentGroups;
+    for (const auto &ppFile : ppFiles) {
+        QByteArrayList groupArguments = arguments;
+        groupArguments.append(QFile::encodeName(ppFile->fileName()));
+        if (ReportHandler::isDebug(ReportHandler::SparseDebug)) {
+            qCInfo(lcShiboken).noquote().nospace()
+                << "clang language level: " << int(m_languageLevel)
+                << "\nclang arguments: " << groupArguments;
+        }
+        if (usePySideExtensions)
+            addPySideExtensions(&groupArguments);
+        argumentGroups.append(groupArguments);
+    }
 
-    const bool result = m_builder->build(arguments, m_languageLevel);
+    const bool result = m_builder->build(argumentGroups, m_languageLevel);
     if (!result)
         autoRemove = false;
     if (!autoRemove) {
-        ppFile.setAutoRemove(false);
-        std::cerr << "Keeping temporary file: " << qPrintable(QDir::toNativeSeparators(preprocessedCppFileName)) << '\n';
+        for (const auto &ppFile : ppFiles) {
+            ppFile->setAutoRemove(false);
+            std::cerr << "Keeping temporary file: "
+                << qPrintable(QDir::toNativeSeparators(ppFile->fileName())) << '\n';
+        }
     }
     return result;
 }
@@ -81,6 +81,8 @@ public:
     void setDropTypeEntries(QString dropEntries);
     LanguageLevel languageLevel() const;
     void setLanguageLevel(LanguageLevel languageLevel);
+    int parserJobs() const { return m_parserJobs; }
+    void setParserJobs(int parserJobs) { m_parserJobs = parserJobs; }
 
     const AbstractMetaEnumList &globalEnums() const;
     const AbstractMetaFunctionList &globalFunctions() const;
@@ -103,6 +105,7 @@ private:
     AbstractMetaBuilder* m_builder = nullptr;
     QString m_logDirectory;
     LanguageLevel m_languageLevel = LanguageLevel::Default;
+    int m_parserJobs = 1;
     bool m_skipDeprecated = false;
 
 #ifndef QT_NO_DEBUG_STREAM
@@ -38,6 +38,10 @@
 #include <QtCore/QScopedArrayPointer>
 #include <QtCore/QString>
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 namespace clang {
 
 QString SourceFileCache::getFileName(CXFile file)
@@ -228,14 +232,11 @@ static QByteArray msgCreateTranslationUnit(const QByteArrayList &clangArgs, unsi
     return result;
 }
 
-static CXTranslationUnit createTranslationUnit(CXIndex index,
-                                               const QByteArrayList &args,
-                                               unsigned flags = 0)
+// Default arguments prepended to the arguments of each translation unit.
+// Note: emulatedCompilerOptions() may run the compiler, so this should
+// be called once from the main thread.
+static QByteArrayList defaultArguments()
 {
-    // courtesy qdoc
-    const unsigned defaultFlags = CXTranslationUnit_SkipFunctionBodies
-        | CXTranslationUnit_Incomplete;
-
     static const QByteArrayList defaultArgs = {
 #ifndef Q_OS_WIN
         "-fPIC",
@@ -246,8 +247,17 @@ static CXTranslationUnit createTranslationUnit(CXIndex index,
 #endif
         "-Wno-constant-logical-operand"
     };
+    return emulatedCompilerOptions() + defaultArgs;
+}
+
+static CXTranslationUnit createTranslationUnit(CXIndex index,
+                                               const QByteArrayList &clangArgs,
+                                               unsigned flags = 0)
+{
+    // courtesy qdoc
+    const unsigned defaultFlags = CXTranslationUnit_SkipFunctionBodies
+        | CXTranslationUnit_Incomplete;
 
-    const QByteArrayList clangArgs = emulatedCompilerOptions() + defaultArgs + args;
     QScopedArrayPointer<const char *> argv(byteArrayListToFlatArgV(clangArgs));
     qDebug().noquote().nospace() << msgCreateTranslationUnit(clangArgs, flags);
 
@@ -267,7 +277,8 @@ static CXTranslationUnit createTranslationUnit(CXIndex index,
  * CXTranslationUnit_KeepGoing (from CINDEX_VERSION_MAJOR/CINDEX_VERSION_MINOR 0.35)
  */
 
-bool parse(const QByteArrayList  &clangArgs, unsigned clangFlags, BaseVisitor &bv)
+static bool parseTranslationUnit(const QByteArrayList &clangArgs, unsigned clangFlags,
+                                 BaseVisitor &bv)
 {
     CXIndex index = clang_createIndex(0 /* excludeDeclarationsFromPCH */,
                                       1 /* displayDiagnostics */);
@@ -304,4 +315,40 @@ bool parse(const QByteArrayList  &clangArgs, unsigned clangFlags, BaseVisitor &b
     return ok;
 }
 
+bool parse(const QByteArrayList  &clangArgs, unsigned clangFlags, BaseVisitor &bv)
+{
+    return parseTranslationUnit(defaultArguments() + clangArgs, clangFlags, bv);
+}
+
+/* Parse several translation units concurrently, each with its own visitor.
+ * Each thread uses a separate CXIndex, which libclang allows to be used
+ * in parallel. Warnings of the threads are serialized by
+ * ReportHandler::messageOutput(). */
+
+bool parse(const QVector<QByteArrayList> &clangArgs, unsigned clangFlags,
+           const QVector<BaseVisitor *> &visitors)
+{
+    Q_ASSERT(clangArgs.size() == visitors.size());
+    const QByteArrayList defaultArgs = defaultArguments();
+    const int count = clangArgs.size();
+    if (count == 1)
+        return parseTranslationUnit(defaultArgs + clangArgs.constFirst(), clangFlags,
+                                    *visitors.constFirst());
+
+    std::vector<char> results(size_t(count), 0);
+    std::vector<std::thread> threads;
+    threads.reserve(size_t(count));
+    for (int i = 0; i < count; ++i) {
+        const QByteArrayList args = defaultArgs + clangArgs.at(i);
+        BaseVisitor *bv = visitors.at(i);
+        char *result = &results[size_t(i)];
+        threads.emplace_back([args, clangFlags, bv, result] () {
+            *result = parseTranslationUnit(args, clangFlags, *bv) ? 1 : 0;
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+    return std::all_of(results.cbegin(), results.cend(), [] (char r) { return r != 0; });
+}
+
 } // namespace clang
@@ -92,6 +92,8 @@ private:
 };
 
 bool parse(const QByteArrayList  &clangArgs, unsigned clangFlags, BaseVisitor &ctx);
+bool parse(const QVector<QByteArrayList> &clangArgs, unsigned clangFlags,
+           const QVector<BaseVisitor *> &visitors);
 
 } // namespace clang
 
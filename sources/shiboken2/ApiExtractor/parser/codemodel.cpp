@@ -1034,6 +1034,136 @@ NamespaceModelItem _NamespaceModelItem::findNamespace(const QString &name) const
 
 _FileModelItem::~_FileModelItem() = default;
 
+// Keys identifying the items of code models of header groups parsed
+// separately, used to skip items seen in several groups when merging.
+static QString modelItemKey(const _CodeModelItem *item)
+{
+    return QString::number(item->kind()) + QLatin1Char(':')
+        + item->qualifiedName().join(QLatin1String("::"));
+}
+
+static QString modelItemKey(const _FunctionModelItem *item)
+{
+    QString result = modelItemKey(static_cast<const _CodeModelItem *>(item))
+        + QLatin1Char('(');
+    const ArgumentList arguments = item->arguments();
+    for (int i = 0, size = arguments.size(); i < size; ++i) {
+        if (i)
+            result += QLatin1Char(',');
+        result += arguments.at(i)->type().toString();
+    }
+    if (item->isVariadics())
+        result += QLatin1String(",...");
+    result += QLatin1Char(')');
+    if (item->isConstant())
+        result += QLatin1String(" const");
+    return result;
+}
+
+// Anonymous enums are named by a counter of each builder (enum_<n>), which
+// differs between groups. Identify them by their enumerators instead.
+static QString modelItemKey(const _EnumModelItem *item)
+{
+    if (item->enumKind() != AnonymousEnum)
+        return modelItemKey(static_cast<const _CodeModelItem *>(item));
+    QStringList qualifiedName = item->qualifiedName();
+    qualifiedName.removeLast();
+    QStringList enumerators;
+    for (const EnumeratorModelItem &enumerator : item->enumerators())
+        enumerators.append(enumerator->name());
+    return QString::number(item->kind()) + QLatin1Char(':')
+        + qualifiedName.join(QLatin1String("::")) + QLatin1String("::{")
+        + enumerators.join(QLatin1Char(',')) + QLatin1Char('}');
+}
+
+// Q_ENUMS declarations are kept per namespace block, so they are seen
+// once per group including the header.
+static QString enumsDeclarationKey(const _NamespaceModelItem &n, const QString &declaration)
+{
+    const QString scope = n.kind() == _CodeModelItem::Kind_File
+        ? QString() : n.qualifiedName().join(QLatin1String("::"));
+    return QLatin1String("Q_ENUMS:") + scope + QLatin1String("::") + declaration;
+}
+
+template <class List>
+static void collectModelItemListKeys(const List &items, QSet<QString> *keys)
+{
+    for (const auto &item : items)
+        keys->insert(modelItemKey(item.data()));
+}
+
+static void collectModelItemKeys(const _NamespaceModelItem &n, QSet<QString> *keys)
+{
+    collectModelItemListKeys(n.classes(), keys);
+    collectModelItemListKeys(n.enums(), keys);
+    collectModelItemListKeys(n.typeDefs(), keys);
+    collectModelItemListKeys(n.templateTypeAliases(), keys);
+    collectModelItemListKeys(n.variables(), keys);
+    collectModelItemListKeys(n.functions(), keys);
+    for (const QString &enumsDeclaration : n.enumsDeclarations())
+        keys->insert(enumsDeclarationKey(n, enumsDeclaration));
+    for (const NamespaceModelItem &child : n.namespaces()) {
+        keys->insert(modelItemKey(child.data()));
+        collectModelItemKeys(*child, keys);
+    }
+}
+
+template <class List, class Add>
+static void mergeModelItems(const List &items, const QSet<QString> &seen, Add add)
+{
+    for (const auto &item : items) {
+        if (!seen.contains(modelItemKey(item.data())))
+            add(item);
+    }
+}
+
+static void mergeNamespace(_NamespaceModelItem *target, const _NamespaceModelItem &source,
+                           QSet<QString> *seen)
+{
+    mergeModelItems(source.classes(), *seen,
+                    [target](const ClassModelItem &i) { target->addClass(i); });
+    mergeModelItems(source.enums(), *seen,
+                    [target](const EnumModelItem &i) { target->addEnum(i); });
+    mergeModelItems(source.typeDefs(), *seen,
+                    [target](const TypeDefModelItem &i) { target->addTypeDef(i); });
+    mergeModelItems(source.templateTypeAliases(), *seen,
+                    [target](const TemplateTypeAliasModelItem &i) {
+                        target->addTemplateTypeAlias(i);
+                    });
+    mergeModelItems(source.variables(), *seen,
+                    [target](const VariableModelItem &i) { target->addVariable(i); });
+    mergeModelItems(source.functions(), *seen,
+                    [target](const FunctionModelItem &i) { target->addFunction(i); });
+    for (const QString &enumsDeclaration : source.enumsDeclarations()) {
+        const QString key = enumsDeclarationKey(source, enumsDeclaration);
+        if (!seen->contains(key)) {
+            seen->insert(key);
+            target->addEnumsDeclaration(enumsDeclaration);
+        }
+    }
+
+    // Namespaces are represented by one item per block (see
+    // clang::Builder), so add a block containing the new items.
+    for (const NamespaceModelItem &child : source.namespaces()) {
+        NamespaceModelItem block(new _NamespaceModelItem(target->model(), child->name()));
+        block->setFileName(child->fileName());
+        block->setScope(child->scope());
+        block->setType(child->type());
+        mergeNamespace(block.data(), *child, seen);
+        if (!block->isEmpty() || !block->namespaces().isEmpty()
+            || !seen->contains(modelItemKey(child.data()))) {
+            target->addNamespace(block);
+        }
+    }
+}
+
+void _FileModelItem::mergeFile(const _FileModelItem &other)
+{
+    QSet<QString> seen;
+    collectModelItemKeys(*this, &seen);
+    mergeNamespace(this, other, &seen);
+}
+
 void  _NamespaceModelItem::appendNamespace(const _NamespaceModelItem &other)
 {
     appendScope(other);
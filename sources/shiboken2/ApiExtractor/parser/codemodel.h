@@ -483,6 +483,10 @@ public:
     explicit _FileModelItem(CodeModel *model, const QString &name, int kind = __node_kind)
         : _NamespaceModelItem(model, name, kind) {}
     ~_FileModelItem();
+
+    // Add the items of a model obtained from parsing another header group,
+    // skipping items already present.
+    void mergeFile(const _FileModelItem &other);
 };
 
 class _ArgumentModelItem: public _CodeModelItem
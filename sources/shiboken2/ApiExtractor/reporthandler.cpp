@@ -30,6 +30,7 @@
 #include "typesystem.h"
 #include "typedatabase.h"
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QMutex>
 #include <QtCore/QSet>
 #include <cstring>
 #include <cstdarg>
@@ -56,6 +57,8 @@ static QString m_prefix;
 static bool m_withinProgress = false;
 static int m_step_warning = 0;
 static QElapsedTimer m_timer;
+// Serializes messages of the clang parser threads (--parser-jobs)
+static QMutex m_messageMutex;
 
 Q_LOGGING_CATEGORY(lcShiboken, "qt.shiboken")
 Q_LOGGING_CATEGORY(lcShibokenDoc, "qt.shiboken.doc")
@@ -122,6 +125,7 @@ void ReportHandler::setPrefix(const QString &p)
 
 void ReportHandler::messageOutput(QtMsgType type, const QMessageLogContext &context, const QString &text)
 {
+    QMutexLocker locker(&m_messageMutex);
     // Check for file location separator added by SourceLocation
     int fileLocationPos = text.indexOf(QLatin1String(":\t"));
     if (type == QtWarningMsg) {
@@ -146,4 +146,64 @@ void TestDropTypeEntries::testDontDropEntryWithChildTags()
     QVERIFY(AbstractMetaClass::findClass(builder->classes(), QLatin1String("ValueA")));
 }
 
+static const char* cppCode3 ="\
+    struct ValueA {\n\
+        void funcA();\n\
+        void funcB();\n\
+        void funcC();\n\
+        void setterA(int);\n\
+        int field;\n\
+    };\n\
+    struct ValueB {\n\
+        void funcA();\n\
+        void funcB();\n\
+    };\n\
+    struct ValueC {};\n";
+
+static const char* xmlCode3 = "\
+<typesystem package='Foo'>\n\
+    <primitive-type name='int'/>\n\
+    <rejection class='ValueA' function-name='funcA'/>\n\
+    <rejection class='*' function-name='funcB'/>\n\
+    <rejection class='^Value[A]$' function-name='^set.*$'/>\n\
+    <rejection class='ValueA' field-name='field'/>\n\
+    <rejection class='ValueC'/>\n\
+    <value-type name='ValueA'/>\n\
+    <value-type name='ValueB'/>\n\
+    <value-type name='ValueC'/>\n\
+</typesystem>\n";
+
+void TestDropTypeEntries::testRejections()
+{
+    QScopedPointer<AbstractMetaBuilder> builder(TestUtil::parse(cppCode3, xmlCode3, false));
+    QVERIFY(!builder.isNull());
+    const AbstractMetaClassList classes = builder->classes();
+    QVERIFY(!AbstractMetaClass::findClass(classes, QLatin1String("ValueC")));
+
+    const AbstractMetaClass *valueA = AbstractMetaClass::findClass(classes, QLatin1String("ValueA"));
+    QVERIFY(valueA);
+    QVERIFY(!valueA->findFunction(QLatin1String("funcA")));
+    QVERIFY(!valueA->findFunction(QLatin1String("funcB")));
+    QVERIFY(valueA->findFunction(QLatin1String("funcC")));
+    QVERIFY(!valueA->findFunction(QLatin1String("setterA")));
+    QVERIFY(valueA->fields().isEmpty());
+
+    const AbstractMetaClass *valueB = AbstractMetaClass::findClass(classes, QLatin1String("ValueB"));
+    QVERIFY(valueB);
+    QVERIFY(valueB->findFunction(QLatin1String("funcA")));
+    QVERIFY(!valueB->findFunction(QLatin1String("funcB")));
+
+    // The first matching rejection is reported.
+    TypeDatabase *td = TypeDatabase::instance();
+    QString reason;
+    QVERIFY(td->isFunctionRejected(QLatin1String("ValueA"), QLatin1String("funcB"), &reason));
+    QVERIFY(reason.contains(QLatin1String("^.*$")));
+    QVERIFY(td->isFunctionRejected(QLatin1String("ValueA"), QLatin1String("setter"), &reason));
+    QVERIFY(reason.contains(QLatin1String("^Value[A]$")));
+    QVERIFY(!td->isFunctionRejected(QLatin1String("ValueAB"), QLatin1String("funcA")));
+    QVERIFY(!td->isFieldRejected(QLatin1String("ValueB"), QLatin1String("field")));
+    QVERIFY(td->isClassRejected(QLatin1String("ValueC")));
+    QVERIFY(!td->isClassRejected(QLatin1String("ValueA")));
+}
+
 QTEST_APPLESS_MAIN(TestDropTypeEntries)
@@ -39,6 +39,7 @@ class TestDropTypeEntries : public QObject
         void testDontDropEntries();
         void testDropEntryWithChildTags();
         void testDontDropEntryWithChildTags();
+        void testRejections();
 };
 
 #endif
@@ -92,5 +92,78 @@ void NamespaceTest::testNamespaceInnerClassMembers()
     QVERIFY(meth);
 }
 
+void NamespaceTest::testNamespaceHeaderGroups()
+{
+    // Two groups sharing the contents of a common header
+    const char* cppCode1 = "\
+    namespace Space {\n\
+        struct Common { void method(); };\n\
+        struct ClassA {};\n\
+    }\n\
+    void globalFunction(int);\n";
+    const char* cppCode2 = "\
+    namespace Space {\n\
+        struct Common { void method(); };\n\
+        struct ClassB {};\n\
+    }\n\
+    void globalFunction(int);\n\
+    void globalFunction(double);\n";
+    const char* xmlCode = "\
+    <typesystem package='Foo'>\n\
+        <primitive-type name='int'/>\n\
+        <primitive-type name='double'/>\n\
+        <namespace-type name='Space'>\n\
+            <value-type name='Common'/>\n\
+            <value-type name='ClassA'/>\n\
+            <value-type name='ClassB'/>\n\
+        </namespace-type>\n\
+        <function signature='globalFunction(int)'/>\n\
+        <function signature='globalFunction(double)'/>\n\
+    </typesystem>\n";
+    QScopedPointer<AbstractMetaBuilder> builder(TestUtil::parseGroups({cppCode1, cppCode2},
+                                                                      xmlCode));
+    QVERIFY(!builder.isNull());
+    const AbstractMetaClassList classes = builder->classes();
+    int commonCount = 0;
+    for (const AbstractMetaClass *c : classes) {
+        if (c->qualifiedCppName() == QLatin1String("Space::Common"))
+            ++commonCount;
+    }
+    QCOMPARE(commonCount, 1);
+    const AbstractMetaClass *common = AbstractMetaClass::findClass(classes, QLatin1String("Space::Common"));
+    QVERIFY(common);
+    QCOMPARE(common->queryFunctionsByName(QLatin1String("method")).size(), 1);
+    QVERIFY(AbstractMetaClass::findClass(classes, QLatin1String("Space::ClassA")));
+    QVERIFY(AbstractMetaClass::findClass(classes, QLatin1String("Space::ClassB")));
+    QCOMPARE(builder->globalFunctions().size(), 2);
+}
+
+void NamespaceTest::testAnonymousEnumHeaderGroups()
+{
+    // Anonymous enums are numbered per group, so the shared one is named
+    // enum_1 in the first group and enum_2 in the second one.
+    const char* cppCode1 = "\
+    enum { Shared0, Shared1 };\n\
+    enum { A0, A1 };\n";
+    const char* cppCode2 = "\
+    enum { B0, B1 };\n\
+    enum { Shared0, Shared1 };\n";
+    const char* xmlCode = "\
+    <typesystem package='Foo'>\n\
+        <enum-type identified-by-value='Shared0'/>\n\
+        <enum-type identified-by-value='A0'/>\n\
+        <enum-type identified-by-value='B0'/>\n\
+    </typesystem>\n";
+    QScopedPointer<AbstractMetaBuilder> builder(TestUtil::parseGroups({cppCode1, cppCode2},
+                                                                      xmlCode));
+    QVERIFY(!builder.isNull());
+    QStringList enumNames;
+    for (const AbstractMetaEnum *metaEnum : builder->globalEnums())
+        enumNames.append(metaEnum->typeEntry()->qualifiedCppName());
+    enumNames.sort();
+    QCOMPARE(enumNames, QStringList({QLatin1String("A0"), QLatin1String("B0"),
+                                     QLatin1String("Shared0")}));
+}
+
 QTEST_APPLESS_MAIN(NamespaceTest)
 
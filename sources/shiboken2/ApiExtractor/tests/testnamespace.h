@@ -39,6 +39,8 @@ class NamespaceTest : public QObject
     private slots:
         void testNamespaceMembers();
         void testNamespaceInnerClassMembers();
+        void testNamespaceHeaderGroups();
+        void testAnonymousEnumHeaderGroups();
 };
 
 #endif
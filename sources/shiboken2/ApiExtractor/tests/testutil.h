@@ -36,12 +36,14 @@
 #include "reporthandler.h"
 #include "typedatabase.h"
 
+#include <memory>
+#include <vector>
+
 namespace TestUtil
 {
-    static AbstractMetaBuilder *parse(const char *cppCode, const char *xmlCode,
-                                      bool silent = true,
-                                      const QString &apiVersion = QString(),
-                                      const QStringList &dropTypeEntries = QStringList())
+    static bool parseTypeSystem(const char *xmlCode, bool silent,
+                                const QString &apiVersion,
+                                const QStringList &dropTypeEntries)
     {
         ReportHandler::setSilent(silent);
         ReportHandler::startTimer();
@@ -49,16 +51,53 @@ namespace TestUtil
         if (apiVersion.isEmpty())
             TypeDatabase::clearApiVersions();
         else if (!TypeDatabase::setApiVersion(QLatin1String("*"), apiVersion))
-            return nullptr;
+            return false;
         td->setDropTypeEntries(dropTypeEntries);
         QBuffer buffer;
         // parse typesystem
         buffer.setData(xmlCode);
         if (!buffer.open(QIODevice::ReadOnly))
-            return Q_NULLPTR;
-        if (!td->parseFile(&buffer))
+            return false;
+        return td->parseFile(&buffer);
+    }
+
+    // Parse each C++ code snippet as a separate translation unit
+    static AbstractMetaBuilder *parseGroups(const QVector<const char *> &cppCodes,
+                                           const char *xmlCode, bool silent = true)
+    {
+        if (!parseTypeSystem(xmlCode, silent, QString(), QStringList()))
+            return nullptr;
+        // parse C++ code
+        QVector<QByteArrayList> argumentGroups;
+        std::vector<std::unique_ptr<QTemporaryFile> > tempSources;
+        for (const char *cppCode : cppCodes) {
+            tempSources.emplace_back(new QTemporaryFile(QDir::tempPath()
+                                                        + QLatin1String("/st_XXXXXX_main.cpp")));
+            QTemporaryFile &tempSource = *tempSources.back();
+            if (!tempSource.open()) {
+                qWarning().noquote().nospace() << "Creation of temporary file failed: "
+                    << tempSource.errorString();
+                return nullptr;
+            }
+            argumentGroups.append(QByteArrayList{QFile::encodeName(tempSource.fileName())});
+            tempSource.write(cppCode, qint64(strlen(cppCode)));
+            tempSource.close();
+        }
+        auto *builder = new AbstractMetaBuilder;
+        if (!builder->build(argumentGroups)) {
+            delete builder;
+            return nullptr;
+        }
+        return builder;
+    }
+
+    static AbstractMetaBuilder *parse(const char *cppCode, const char *xmlCode,
+                                      bool silent = true,
+                                      const QString &apiVersion = QString(),
+                                      const QStringList &dropTypeEntries = QStringList())
+    {
+        if (!parseTypeSystem(xmlCode, silent, apiVersion, dropTypeEntries))
             return nullptr;
-        buffer.close();
         // parse C++ code
         QTemporaryFile tempSource(QDir::tempPath() + QLatin1String("/st_XXXXXX_main.cpp"));
         if (!tempSource.open()) {
@@ -159,22 +159,16 @@ void TypeDatabase::addInlineNamespaceLookups(const NamespaceTypeEntry *n)
         if (entry->isChildOf(n))
             additionalEntries.append(entry);
     }
-    for (const auto &ae : additionalEntries)
+    for (const auto &ae : additionalEntries) {
         m_entries.insert(ae->shortName(), ae);
+        updateEntryIndex(ae->shortName());
+    }
 }
 
 ContainerTypeEntry* TypeDatabase::findContainerType(const QString &name) const
 {
-    QString template_name = name;
-
-    int pos = name.indexOf(QLatin1Char('<'));
-    if (pos > 0)
-        template_name = name.left(pos);
-
-    TypeEntry* type_entry = findType(template_name);
-    if (type_entry && type_entry->isContainer())
-        return static_cast<ContainerTypeEntry*>(type_entry);
-    return nullptr;
+    const int pos = name.indexOf(QLatin1Char('<'));
+    return m_entryIndex.value(pos > 0 ? name.left(pos) : name).containerType;
 }
 
 static bool inline useType(const TypeEntry *t)
@@ -185,12 +179,7 @@ static bool inline useType(const TypeEntry *t)
 
 FunctionTypeEntry* TypeDatabase::findFunctionType(const QString& name) const
 {
-    const auto entries = findTypeRange(name);
-    for (TypeEntry *entry : entries) {
-        if (entry->type() == TypeEntry::FunctionType && useType(entry))
-            return static_cast<FunctionTypeEntry*>(entry);
-    }
-    return nullptr;
+    return m_entryIndex.value(name).functionType;
 }
 
 void TypeDatabase::addTypeSystemType(const TypeSystemTypeEntry *e)
@@ -220,12 +209,7 @@ QString TypeDatabase::defaultPackageName() const
 
 TypeEntry* TypeDatabase::findType(const QString& name) const
 {
-    const auto entries = findTypeRange(name);
-    for (TypeEntry *entry : entries) {
-        if (useType(entry))
-            return entry;
-    }
-    return nullptr;
+    return m_entryIndex.value(name).type;
 }
 
 template <class Predicate>
@@ -280,6 +264,35 @@ TypeEntryMultiMapConstIteratorRange TypeDatabase::findTypeRange(const QString &n
     return {range.first, range.second};
 }
 
+// Recompute the first entries of a name matching the predicates of the
+// find*Type() functions after an insertion into m_entries.
+void TypeDatabase::updateEntryIndex(const QString &name)
+{
+    TypeEntryIndex index;
+    for (TypeEntry *entry : findTypeRange(name)) {
+        if (!index.primitiveType && entry->isPrimitive()) {
+            auto *pe = static_cast<PrimitiveTypeEntry *>(entry);
+            if (pe->preferredTargetLangType())
+                index.primitiveType = pe;
+        }
+        if (!useType(entry))
+            continue;
+        if (!index.type) {
+            index.type = entry;
+            // findContainerType() only considers the entry found by findType()
+            if (entry->isContainer())
+                index.containerType = static_cast<ContainerTypeEntry *>(entry);
+        }
+        if (!index.complexType && entry->isComplex())
+            index.complexType = static_cast<ComplexTypeEntry *>(entry);
+        if (!index.objectType && entry->isObject())
+            index.objectType = static_cast<ObjectTypeEntry *>(entry);
+        if (!index.functionType && entry->type() == TypeEntry::FunctionType)
+            index.functionType = static_cast<FunctionTypeEntry *>(entry);
+    }
+    m_entryIndex.insert(name, index);
+}
+
 PrimitiveTypeEntryList TypeDatabase::primitiveTypes() const
 {
     PrimitiveTypeEntryList returned;
@@ -314,9 +327,58 @@ QDebug operator<<(QDebug d, const TypeRejection &r)
 }
 #endif // !QT_NO_DEBUG_STREAM
 
+// Return the string matched by a literal pattern "^text$" as created by
+// the type system parser, or a null string for other patterns.
+static QString literalPattern(const QRegularExpression &re)
+{
+    if (re.patternOptions() != QRegularExpression::NoPatternOption)
+        return QString();
+    const QString pattern = re.pattern();
+    const int size = pattern.size();
+    if (size < 2 || !pattern.startsWith(QLatin1Char('^'))
+        || !pattern.endsWith(QLatin1Char('$'))) {
+        return QString();
+    }
+    QString result;
+    result.reserve(size);
+    for (int i = 1; i < size - 1; ++i) {
+        if (pattern.at(i) == QLatin1Char('\\') && ++i == size - 1)
+            return QString(); // Escaped '$'
+        result.append(pattern.at(i));
+    }
+    if (QRegularExpression::escape(result) != pattern.midRef(1, size - 2))
+        return QString();
+    return result;
+}
+
+static inline bool isAnyPattern(const QRegularExpression &re)
+{
+    return re.pattern() == QLatin1String("^.*$")
+        && re.patternOptions() == QRegularExpression::NoPatternOption;
+}
+
 void TypeDatabase::addRejection(const TypeRejection &r)
 {
+    const int index = m_rejections.size();
     m_rejections << r;
+    if (r.matchType == TypeRejection::Invalid)
+        return;
+    if (m_rejectionIndex.isEmpty())
+        m_rejectionIndex.resize(TypeRejection::Invalid);
+    TypeRejectionIndex &rejectionIndex = m_rejectionIndex[r.matchType];
+    const QString className = literalPattern(r.className);
+    if (!className.isNull()) {
+        rejectionIndex.byClassName[className].append(index);
+        return;
+    }
+    if (r.matchType != TypeRejection::ExcludeClass && isAnyPattern(r.className)) {
+        const QString name = literalPattern(r.pattern);
+        if (!name.isNull()) {
+            rejectionIndex.byNameForAnyClass[name].append(index);
+            return;
+        }
+    }
+    rejectionIndex.others.append(index);
 }
 
 static inline QString msgRejectReason(const TypeRejection &r, const QString &needle = QString())
@@ -343,11 +405,37 @@ static inline QString msgRejectReason(const TypeRejection &r, const QString &nee
     return result;
 }
 
+// Collect the indexes of the rejections which can match the class name
+// and name in order of addition, so that the first match is reported.
+static QVector<int> rejectionCandidates(const QVector<TypeRejectionIndex> &rejectionIndex,
+                                        TypeRejection::MatchType matchType,
+                                        const QString &className, const QString &name)
+{
+    if (rejectionIndex.isEmpty())
+        return {};
+    const TypeRejectionIndex &index = rejectionIndex.at(matchType);
+    QVector<int> result = index.others;
+    const auto classIt = index.byClassName.constFind(className);
+    if (classIt != index.byClassName.cend())
+        result += classIt.value();
+    if (matchType != TypeRejection::ExcludeClass) {
+        const auto nameIt = index.byNameForAnyClass.constFind(name);
+        if (nameIt != index.byNameForAnyClass.cend())
+            result += nameIt.value();
+    }
+    if (result.size() > 1)
+        std::sort(result.begin(), result.end());
+    return result;
+}
+
 // Match class name only
 bool TypeDatabase::isClassRejected(const QString& className, QString *reason) const
 {
-    for (const TypeRejection& r : m_rejections) {
-        if (r.matchType == TypeRejection::ExcludeClass && r.className.match(className).hasMatch()) {
+    const auto candidates = rejectionCandidates(m_rejectionIndex, TypeRejection::ExcludeClass,
+                                                className, QString());
+    for (int i : candidates) {
+        const TypeRejection &r = m_rejections.at(i);
+        if (r.className.match(className).hasMatch()) {
             if (reason)
                 *reason = msgRejectReason(r);
             return true;
@@ -358,14 +446,16 @@ bool TypeDatabase::isClassRejected(const QString& className, QString *reason) co
 
 // Match class name and function/enum/field
 static bool findRejection(const QVector<TypeRejection> &rejections,
+                          const QVector<TypeRejectionIndex> &rejectionIndex,
                           TypeRejection::MatchType matchType,
                           const QString& className, const QString& name,
                           QString *reason = nullptr)
 {
     Q_ASSERT(matchType != TypeRejection::ExcludeClass);
-    for (const TypeRejection& r : rejections) {
-        if (r.matchType == matchType && r.pattern.match(name).hasMatch()
-            && r.className.match(className).hasMatch()) {
+    const auto candidates = rejectionCandidates(rejectionIndex, matchType, className, name);
+    for (int i : candidates) {
+        const TypeRejection &r = rejections.at(i);
+        if (r.pattern.match(name).hasMatch() && r.className.match(className).hasMatch()) {
             if (reason)
                 *reason = msgRejectReason(r, name);
             return true;
@@ -376,7 +466,8 @@ static bool findRejection(const QVector<TypeRejection> &rejections,
 
 bool TypeDatabase::isEnumRejected(const QString& className, const QString& enumName, QString *reason) const
 {
-    return findRejection(m_rejections, TypeRejection::Enum, className, enumName, reason);
+    return findRejection(m_rejections, m_rejectionIndex, TypeRejection::Enum,
+                         className, enumName, reason);
 }
 
 TypeEntry *TypeDatabase::resolveTypeDefEntry(TypedefEntry *typedefEntry,
@@ -423,6 +514,7 @@ bool TypeDatabase::addType(TypeEntry *e, QString *errorMessage)
             return false;
     }
     m_entries.insert(e->qualifiedCppName(), e);
+    updateEntryIndex(e->qualifiedCppName());
     return true;
 }
 
@@ -440,25 +532,29 @@ ConstantValueTypeEntry *
 bool TypeDatabase::isFunctionRejected(const QString& className, const QString& functionName,
                                       QString *reason) const
 {
-    return findRejection(m_rejections, TypeRejection::Function, className, functionName, reason);
+    return findRejection(m_rejections, m_rejectionIndex, TypeRejection::Function,
+                         className, functionName, reason);
 }
 
 bool TypeDatabase::isFieldRejected(const QString& className, const QString& fieldName,
                                    QString *reason) const
 {
-    return findRejection(m_rejections, TypeRejection::Field, className, fieldName, reason);
+    return findRejection(m_rejections, m_rejectionIndex, TypeRejection::Field,
+                         className, fieldName, reason);
 }
 
 bool TypeDatabase::isArgumentTypeRejected(const QString& className, const QString& typeName,
                                           QString *reason) const
 {
-    return findRejection(m_rejections, TypeRejection::ArgumentType, className, typeName, reason);
+    return findRejection(m_rejections, m_rejectionIndex, TypeRejection::ArgumentType,
+                         className, typeName, reason);
 }
 
 bool TypeDatabase::isReturnTypeRejected(const QString& className, const QString& typeName,
                                         QString *reason) const
 {
-    return findRejection(m_rejections, TypeRejection::ReturnType, className, typeName, reason);
+    return findRejection(m_rejections, m_rejectionIndex, TypeRejection::ReturnType,
+                         className, typeName, reason);
 }
 
 FlagsTypeEntry* TypeDatabase::findFlagsType(const QString &name) const
@@ -657,36 +753,17 @@ bool TypeDatabase::parseFile(QIODevice* device, bool generate)
 
 PrimitiveTypeEntry *TypeDatabase::findPrimitiveType(const QString& name) const
 {
-    const auto entries = findTypeRange(name);
-    for (TypeEntry *entry : entries) {
-        if (entry->isPrimitive()) {
-            auto *pe = static_cast<PrimitiveTypeEntry *>(entry);
-            if (pe->preferredTargetLangType())
-                return pe;
-        }
-    }
-
-    return nullptr;
+    return m_entryIndex.value(name).primitiveType;
 }
 
 ComplexTypeEntry* TypeDatabase::findComplexType(const QString& name) const
 {
-    const auto entries = findTypeRange(name);
-    for (TypeEntry *entry : entries) {
-        if (entry->isComplex() && useType(entry))
-            return static_cast<ComplexTypeEntry*>(entry);
-    }
-    return nullptr;
+    return m_entryIndex.value(name).complexType;
 }
 
 ObjectTypeEntry* TypeDatabase::findObjectType(const QString& name) const
 {
-    const auto entries = findTypeRange(name);
-    for (TypeEntry *entry : entries) {
-        if (entry && entry->isObject() && useType(entry))
-            return static_cast<ObjectTypeEntry*>(entry);
-    }
-    return nullptr;
+    return m_entryIndex.value(name).objectType;
 }
 
 NamespaceTypeEntryList TypeDatabase::findNamespaceTypes(const QString& name) const
@@ -35,6 +35,7 @@
 #include "typesystem_enums.h"
 #include "typesystem_typedefs.h"
 
+#include <QtCore/QHash>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QStringList>
 #include <QtCore/QVersionNumber>
@@ -52,6 +53,15 @@ class TypeEntry;
 
 struct TypeRejection;
 
+// Rejections of one match type, bucketed by literal class/name patterns
+// so that only candidates which can match need to be evaluated.
+struct TypeRejectionIndex
+{
+    QHash<QString, QVector<int> > byClassName;
+    QHash<QString, QVector<int> > byNameForAnyClass;
+    QVector<int> others;
+};
+
 QT_FORWARD_DECLARE_CLASS(QDebug)
 
 int getMaxTypeIndex();
@@ -195,9 +205,23 @@ private:
     TypeEntry *resolveTypeDefEntry(TypedefEntry *typedefEntry, QString *errorMessage);
     template <class String>
     bool isSuppressedWarningHelper(const String &s) const;
+    void updateEntryIndex(const QString &name);
+
+    // First entries of a name matching the find*Type() predicates,
+    // maintained on insertion to avoid scanning the multi map.
+    struct TypeEntryIndex
+    {
+        TypeEntry *type = nullptr;
+        PrimitiveTypeEntry *primitiveType = nullptr;
+        ComplexTypeEntry *complexType = nullptr;
+        ContainerTypeEntry *containerType = nullptr;
+        ObjectTypeEntry *objectType = nullptr;
+        FunctionTypeEntry *functionType = nullptr;
+    };
 
     bool m_suppressWarnings = true;
     TypeEntryMultiMap m_entries; // Contains duplicate entries (cf addInlineNamespaceLookups).
+    QHash<QString, TypeEntryIndex> m_entryIndex;
     TypeEntryMap m_flagsEntries;
     TypedefEntryMap m_typedefEntries;
     TemplateEntryMap m_templates;
@@ -213,6 +237,7 @@ private:
     QHash<QString, bool> m_parsedTypesystemFiles;
 
     QVector<TypeRejection> m_rejections;
+    QVector<TypeRejectionIndex> m_rejectionIndex; // Indexed by TypeRejection::MatchType
 
     QStringList m_dropTypeEntries;
     QByteArrayList m_systemIncludes;
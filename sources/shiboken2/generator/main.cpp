@@ -30,6 +30,7 @@
 #include <QLibrary>
 #include <QtCore/QFile>
 #include <QtCore/QDir>
+#include <QtCore/QThread>
 #include <iostream>
 #include <apiextractor.h>
 #include <fileout.h>
@@ -58,6 +59,7 @@ static inline QString helpOption() { return QStringLiteral("help"); }
 static inline QString diffOption() { return QStringLiteral("diff"); }
 static inline QString dryrunOption() { return QStringLiteral("dry-run"); }
 static inline QString skipDeprecatedOption() { return QStringLiteral("skip-deprecated"); }
+static inline QString parserJobsOption() { return QStringLiteral("parser-jobs"); }
 
 static const char helpHint[] = "Note: use --help or -h for more information.\n";
 
@@ -330,6 +332,9 @@ void printUsage()
                      QLatin1String("File used for copyright headers of generated files"))
         << qMakePair(QLatin1String("no-suppress-warnings"),
                      QLatin1String("Show all warnings"))
+        << qMakePair(parserJobsOption() + QLatin1String("=<n>"),
+                     QLatin1String("Number of header groups parsed concurrently by the C++ parser\n"
+                                   "(0: number of CPU cores, default: 1)"))
         << qMakePair(QLatin1String("output-directory=<path>"),
                      QLatin1String("The directory where the generated files will be written"))
         << qMakePair(QLatin1String("project-file=<file>"),
@@ -530,6 +535,20 @@ int main(int argc, char *argv[])
         args.options.erase(ait);
     }
 
+    ait = args.options.find(parserJobsOption());
+    if (ait != args.options.end()) {
+        bool ok;
+        int parserJobs = ait.value().toInt(&ok);
+        if (!ok || parserJobs < 0) {
+            errorPrint(QLatin1String("Invalid number of parser jobs: ") + ait.value());
+            return EXIT_FAILURE;
+        }
+        if (parserJobs == 0)
+            parserJobs = QThread::idealThreadCount();
+        extractor.setParserJobs(parserJobs);
+        args.options.erase(ait);
+    }
+
     ait = args.options.find(QLatin1String("typesystem-paths"));
     if (ait != args.options.end()) {
         extractor.addTypesystemSearchPath(ait.value().split(pathSplitter));
@@ -56,6 +56,8 @@ QHash<QString, QString> CppGenerator::m_mpFuncs = QHash<QString, QString>();
 QString CppGenerator::m_currentErrorCode(QLatin1String("{}"));
 
 static const char typeNameFunc[] = R"CPP(
+#ifndef SBK_TYPENAMEOF_DEFINED
+#define SBK_TYPENAMEOF_DEFINED
 template <class T>
 static const char *typeNameOf(const T &t)
 {
@@ -79,8 +81,13 @@ static const char *typeNameOf(const T &t)
     memcpy(result, typeName, size);
     return result;
 }
+#endif // SBK_TYPENAMEOF_DEFINED
 )CPP";
 
+// Macro defined by the amalgamated files written for --unity-build, the
+// wrappers they include are only compiled as part of them.
+static const char unityBuildChunkMacro[] = "SBK_UNITY_BUILD_CHUNK";
+
 // utility functions
 inline AbstractMetaType *getTypeWithoutContainer(AbstractMetaType *arg)
 {
@@ -337,6 +344,40 @@ static void writePyGetSetDefEntry(QTextStream &s, const QString &name,
     \param s the output buffer
     \param metaClass the pointer to metaclass information
 */
+// Returns the namespace for which the wrapper of a class emits a using directive.
+static const AbstractMetaClass *usingNamespaceContext(const AbstractMetaClass *metaClass)
+{
+    for (auto context = metaClass->enclosingClass(); context; context = context->enclosingClass()) {
+        if (context->isNamespace() && !context->enclosingClass()
+            && static_cast<const NamespaceTypeEntry *>(context->typeEntry())->generateUsing()) {
+            return context;
+        }
+    }
+    return nullptr;
+}
+
+// Returns whether the wrapper of a class may share a translation unit with
+// others. Wrappers which emit file scope code not derived from the class
+// name (smart pointer getters, using directives, native code snippets and
+// conversion rules of the type system) are compiled on their own.
+bool CppGenerator::isUnityBuildMember(const GeneratorContext &classContext) const
+{
+    if (unityBuildChunks() <= 0 || classContext.forSmartPointer())
+        return false;
+    const AbstractMetaClass *metaClass = classContext.metaClass();
+    if (subDirectoryForClass(metaClass) != subDirectoryForPackage(packageName())
+        || usingNamespaceContext(metaClass) != nullptr
+        || metaClass->typeEntry()->hasTargetConversionRule()) {
+        return false;
+    }
+    const CodeSnipList &codeSnips = metaClass->typeEntry()->codeSnips();
+    for (const CodeSnip &snip : codeSnips) {
+        if (snip.language == TypeSystem::NativeCode)
+            return false;
+    }
+    return true;
+}
+
 void CppGenerator::generateClass(QTextStream &s, const GeneratorContext &classContext)
 {
     const AbstractMetaClass *metaClass = classContext.metaClass();
@@ -344,6 +385,13 @@ void CppGenerator::generateClass(QTextStream &s, const GeneratorContext &classCo
     // write license comment
     s << licenseComment() << Qt::endl;
 
+    const bool unityBuildMember = isUnityBuildMember(classContext);
+    if (unityBuildMember) {
+        m_unityBuildFiles.append(fileNameForContext(classContext));
+        s << "// Compiled as part of " << unityBuildFileName(m_unityBuildFiles.size() - 1) << '\n'
+            << "#ifdef " << unityBuildChunkMacro << "\n\n";
+    }
+
     // disabling warnings
     s << "#ifdef _MSC_VER" << endl;
     {
@@ -442,17 +490,8 @@ void CppGenerator::generateClass(QTextStream &s, const GeneratorContext &classCo
         s << "#Deprecated\n";
 
     // Use class base namespace
-    {
-        const AbstractMetaClass *context = metaClass->enclosingClass();
-        while (context) {
-            if (context->isNamespace() && !context->enclosingClass()
-                && static_cast<const NamespaceTypeEntry *>(context->typeEntry())->generateUsing()) {
-                s << "\nusing namespace " << context->qualifiedCppName() << ";\n";
-                break;
-            }
-            context = context->enclosingClass();
-        }
-    }
+    if (const AbstractMetaClass *context = usingNamespaceContext(metaClass))
+        s << "\nusing namespace " << context->qualifiedCppName() << ";\n";
 
     s << Qt::endl << Qt::endl << typeNameFunc << Qt::endl;
 
@@ -792,6 +831,41 @@ void CppGenerator::generateClass(QTextStream &s, const GeneratorContext &classCo
                             classContext);
         s << Qt::endl;
     }
+
+    if (unityBuildMember)
+        s << "#endif // " << unityBuildChunkMacro << '\n';
+}
+
+QString CppGenerator::unityBuildFileName(int index) const
+{
+    return moduleName().toLower() + QLatin1String("_unity_")
+        + QString::number(index % unityBuildChunks()) + QLatin1String(".cpp");
+}
+
+// Writes the amalgamated files including the wrappers of the unity build
+// members. All chunks are written, empty ones included, so that the build
+// system can list them in advance.
+bool CppGenerator::writeUnityBuildFiles()
+{
+    const int chunks = unityBuildChunks();
+    const QString directory = outputDirectory() + QLatin1Char('/')
+        + subDirectoryForPackage(packageName()) + QLatin1Char('/');
+    for (int chunk = 0; chunk < chunks; ++chunk) {
+        const QString fileName = directory + unityBuildFileName(chunk);
+        verifyDirectoryFor(fileName);
+        FileOut file(fileName);
+        QTextStream &s = file.stream;
+        s << licenseComment() << Qt::endl;
+        s << "#define " << unityBuildChunkMacro << Qt::endl;
+        if (!avoidProtectedHack())
+            s << "//workaround to access protected functions\n#define protected public\n";
+        s << Qt::endl;
+        for (int i = chunk; i < m_unityBuildFiles.size(); i += chunks)
+            s << "#include \"" << m_unityBuildFiles.at(i) << "\"\n";
+        if (file.done() == FileOut::Failure)
+            return false;
+    }
+    return true;
 }
 
 void CppGenerator::writeCacheResetNative(QTextStream &s, const GeneratorContext &classContext)
@@ -1718,7 +1792,7 @@ void CppGenerator::writeConverterRegister(QTextStream &s, const AbstractMetaClas
     QString targetTypeName = sourceTypeName + QLatin1String("_COPY");
     QString toCpp = pythonToCppFunctionName(sourceTypeName, targetTypeName);
     QString isConv = convertibleToCppFunctionName(sourceTypeName, targetTypeName);
-    writeAddPythonToCppConversion(s, QLatin1String("converter"), toCpp, isConv);
+    writeAddPythonToCppConversion(s, QLatin1String("converter"), toCpp, isConv, true);
 
     // User provided implicit conversions.
     CustomConversion *customConversion = metaClass->typeEntry()->customConversion();
@@ -1749,9 +1823,14 @@ void CppGenerator::writeConverterRegister(QTextStream &s, const AbstractMetaClas
                 continue;
             sourceType = conv->arguments().constFirst()->type();
         }
+        // Conversions from wrapped types, enums and flags are decided by a
+        // plain type check, which libshiboken may cache per Python type.
+        const TypeEntry *sourceEntry = sourceType->typeEntry();
+        const bool checksTypeOnly = conv->isConversionOperator() || isWrapperType(sourceType)
+                                    || sourceEntry->isEnum() || sourceEntry->isFlags();
         QString toCpp = pythonToCppFunctionName(sourceType, targetType);
         QString isConv = convertibleToCppFunctionName(sourceType, targetType);
-        writeAddPythonToCppConversion(s, QLatin1String("converter"), toCpp, isConv);
+        writeAddPythonToCppConversion(s, QLatin1String("converter"), toCpp, isConv, checksTypeOnly);
     }
 
     writeCustomConverterRegister(s, customConversion, QLatin1String("converter"));
@@ -2017,12 +2096,197 @@ void CppGenerator::writeConstructorWrapper(QTextStream &s, const AbstractMetaFun
     s<< "}\n\n";
 }
 
+// Maximum number of arguments handled by Shiboken::MethodDispatch::call().
+static const int tableDrivenMaxArguments = 8;
+
+static const char tableDrivenArgumentKind[] = "Shiboken::MethodDispatch::ArgumentKind::";
+
+// Returns the Shiboken::MethodDispatch::ArgumentKind enumerator for an
+// argument type which the dispatcher can check and convert, or an empty string.
+QString CppGenerator::tableDrivenArgumentKindName(const AbstractMetaType *type) const
+{
+    const bool byValue = type->referenceType() == NoReference
+        || (type->referenceType() == LValueReference && type->isConstant());
+    const TypeEntry *typeEntry = type->typeEntry();
+    if (type->indirections() == 0 && byValue) {
+        if (typeEntry->isCppPrimitive())
+            return QLatin1String("Primitive");
+        if (typeEntry->isEnum() || typeEntry->isFlags()) {
+            const AbstractMetaEnum *metaEnum = findAbstractMetaEnum(type);
+            return metaEnum && metaEnum->isProtected() ? QString() : QLatin1String("Enum");
+        }
+        return QString();
+    }
+    if (type->referenceType() == NoReference && isPointerToWrapperType(type)
+        && !typeEntry->isSmartPointer()) {
+        return QLatin1String("ObjectPointer");
+    }
+    return QString();
+}
+
+// Returns whether a method wrapper can be expressed as a descriptor for
+// Shiboken::MethodDispatch::call(): a single public, non-virtual instance
+// method without default values, modifications or injected code whose
+// arguments are primitives, enums or pointers to wrapped types and whose
+// result is returned by value or const reference.
+bool CppGenerator::isTableDrivenMethod(const OverloadData &overloadData,
+                                       const GeneratorContext &context) const
+{
+    if (!useTableDrivenWrappers() || context.forSmartPointer())
+        return false;
+    const AbstractMetaFunction *func = overloadData.referenceFunction();
+    if (overloadData.overloadsWithoutRepetition().size() != 1
+        || overloadData.hasArgumentWithDefaultValue() || overloadData.hasVarargs()
+        || overloadData.maxArgs() > tableDrivenMaxArguments
+        || overloadData.minArgs() != overloadData.maxArgs()) {
+        return false;
+    }
+    const AbstractMetaClass *ownerClass = func->ownerClass();
+    if (!ownerClass || ownerClass->isNamespace() || func->isConstructor() || func->isStatic()
+        || func->isVirtual() || func->isAbstract() || func->isProtected()
+        || func->isOperatorOverload() || func->isCallOperator() || func->isUserAdded()
+        || func->isDeprecated() || func->hasInjectedCode() || func->generateExceptionHandling()
+        || !func->modifications(ownerClass).isEmpty()) {
+        return false;
+    }
+    const AbstractMetaArgumentList &arguments = func->arguments();
+    if (arguments.size() != overloadData.maxArgs())
+        return false;
+    for (const AbstractMetaArgument *arg : arguments) {
+        if (tableDrivenArgumentKindName(arg->type()).isEmpty())
+            return false;
+    }
+    if (func->isVoid())
+        return true;
+    const AbstractMetaType *type = func->type();
+    if (type->indirections() != 0 || type->typeEntry()->isObject()
+        || type->typeEntry()->isSmartPointer() || isCString(type)) {
+        return false;
+    }
+    if (type->referenceType() != NoReference
+        && !(type->referenceType() == LValueReference && type->isConstant())) {
+        return false;
+    }
+    const AbstractMetaEnum *metaEnum = findAbstractMetaEnum(type);
+    return !metaEnum || !metaEnum->isProtected();
+}
+
+void CppGenerator::writeTableDrivenMethodWrapper(QTextStream &s, const OverloadData &overloadData,
+                                                 const GeneratorContext &context)
+{
+    const AbstractMetaFunction *func = overloadData.referenceFunction();
+    // Like writeCppSelfDefinition(), use the class being generated rather than
+    // the owner of an inherited method for the type check and the cast.
+    const AbstractMetaClass *metaClass = context.metaClass();
+    const QString functionName = cpythonFunctionName(func);
+    const AbstractMetaArgumentList &arguments = func->arguments();
+    const QString className = QLatin1String("::") + metaClass->qualifiedCppName();
+
+    // The C++ call, the only part of the wrapper specific to the method.
+    s << "static PyObject *" << functionName
+        << "_Call(void *self, Shiboken::MethodDispatch::Argument *args)\n{\n";
+    {
+        Indentation indent(INDENT);
+        s << INDENT << "auto " << CPP_SELF_VAR << " = reinterpret_cast<" << className << " *>(self);\n";
+        if (arguments.isEmpty())
+            s << INDENT << "SBK_UNUSED(args)\n";
+        QStringList userArgs;
+        for (int i = 0, size = arguments.size(); i < size; ++i) {
+            const AbstractMetaType *type = arguments.at(i)->type();
+            QString typeName = getFullTypeNameWithoutModifiers(type);
+            if (isPointerToWrapperType(type))
+                typeName += QLatin1String(" *");
+            userArgs.append(QLatin1String("*reinterpret_cast<") + typeName
+                            + QLatin1String(" *>(&args[") + QString::number(i) + QLatin1String("])"));
+        }
+        QString methodCall;
+        if (func->isConstant())
+            methodCall = QLatin1String("const_cast<const ") + className + QLatin1String(" *>(")
+                + QLatin1String(CPP_SELF_VAR) + QLatin1String(")->");
+        else
+            methodCall = QLatin1String(CPP_SELF_VAR) + QLatin1String("->");
+        methodCall += func->originalName() + QLatin1Char('(')
+            + userArgs.join(QLatin1String(", ")) + QLatin1Char(')');
+
+        if (func->allowThread())
+            s << INDENT << BEGIN_ALLOW_THREADS << Qt::endl;
+        s << INDENT;
+        if (!func->isVoid())
+            s << func->type()->cppSignature() << ' ' << CPP_RETURN_VAR << " = ";
+        s << methodCall << ";\n";
+        if (func->allowThread())
+            s << INDENT << END_ALLOW_THREADS << Qt::endl;
+        if (func->isVoid()) {
+            s << INDENT << "Py_RETURN_NONE;\n";
+        } else {
+            s << INDENT << "return ";
+            writeToPythonConversion(s, func->type(), metaClass, QLatin1String(CPP_RETURN_VAR));
+            s << ";\n";
+        }
+    }
+    s << "}\n\n";
+
+    // The argument descriptions and the method descriptor.
+    const QString argumentsName = functionName + QLatin1String("_Arguments");
+    if (!arguments.isEmpty()) {
+        s << "static const Shiboken::MethodDispatch::ArgumentSpec " << argumentsName << "[] = {\n";
+        Indentation indent(INDENT);
+        for (const AbstractMetaArgument *arg : arguments) {
+            const AbstractMetaType *type = arg->type();
+            const QString kind = tableDrivenArgumentKindName(type);
+            s << INDENT << '{' << tableDrivenArgumentKind << kind << ", ";
+            if (kind == QLatin1String("Primitive")) {
+                s << NULL_PTR << ", 0, &Shiboken::Conversions::PrimitiveTypeConverter<"
+                    << type->typeEntry()->qualifiedCppName() << '>';
+            } else {
+                s << '&' << cppApiVariableName(type->typeEntry()->targetLangPackage()) << ", "
+                    << getTypeIndexVariableName(type) << ", " << NULL_PTR;
+            }
+            s << "},\n";
+        }
+        s << "};\n\n";
+    }
+    s << "static const Shiboken::MethodDispatch::MethodDescriptor " << functionName
+        << "_Descriptor = {\n";
+    {
+        Indentation indent(INDENT);
+        s << INDENT << '"' << fullPythonFunctionName(func, true) << "\",\n";
+        s << INDENT << '&' << cppApiVariableName(metaClass->typeEntry()->targetLangPackage())
+            << ", " << getTypeIndexVariableName(metaClass->typeEntry()) << ",\n";
+        s << INDENT << arguments.size() << ", "
+            << (arguments.isEmpty() ? QLatin1String(NULL_PTR) : argumentsName) << ",\n";
+        s << INDENT << functionName << "_Call\n";
+    }
+    s << "};\n\n";
+
+    // The Python method, which has the signature expected by the method definition.
+    s << "static PyObject *" << functionName << "(PyObject *self";
+    if (!arguments.isEmpty())
+        s << ", PyObject *" << (arguments.size() > 1 ? "args" : PYTHON_ARG);
+    s << ")\n{\n";
+    {
+        Indentation indent(INDENT);
+        s << INDENT << "return Shiboken::MethodDispatch::call(self, ";
+        if (arguments.isEmpty())
+            s << NULL_PTR;
+        else
+            s << (arguments.size() > 1 ? "args" : PYTHON_ARG);
+        s << ", " << functionName << "_Descriptor);\n";
+    }
+    s << "}\n\n";
+}
+
 void CppGenerator::writeMethodWrapper(QTextStream &s, const AbstractMetaFunctionList &overloads,
                                       const GeneratorContext &classContext)
 {
     OverloadData overloadData(overloads, this);
     const AbstractMetaFunction *rfunc = overloadData.referenceFunction();
 
+    if (isTableDrivenMethod(overloadData, classContext)) {
+        writeTableDrivenMethodWrapper(s, overloadData, classContext);
+        return;
+    }
+
     int maxArgs = overloadData.maxArgs();
 
     s << "static PyObject *";
@@ -2689,7 +2953,10 @@ void CppGenerator::writeOverloadedFunctionDecisor(QTextStream &s, const Overload
             s << decl->name() << "::";
         s << func->minimalSignature() << Qt::endl;
     }
-    writeOverloadedFunctionDecisorEngine(s, &overloadData);
+    if (useOverloadCache() && isOverloadDecisionCacheable(overloadData))
+        writeCachedOverloadedFunctionDecisorEngine(s, overloadData);
+    else
+        writeOverloadedFunctionDecisorEngine(s, &overloadData);
     s << Qt::endl;
 
     // Ensure that the direct overload that called this reverse
@@ -2709,6 +2976,66 @@ void CppGenerator::writeOverloadedFunctionDecisor(QTextStream &s, const Overload
     s << Qt::endl;
 }
 
+// Returns whether the decision depends on the Python types of the arguments
+// only. Containers, arrays and type replacements may inspect the argument
+// values, reverse operators depend on the isReverse flag.
+bool CppGenerator::isOverloadDecisionCacheable(const OverloadData &overloadData)
+{
+    const AbstractMetaFunction *rfunc = overloadData.referenceFunction();
+    if (overloadData.hasVarargs() || rfunc->isOperatorOverload())
+        return false;
+    const OverloadData::MetaFunctionList &overloads = overloadData.overloads();
+    for (const AbstractMetaFunction *func : overloads) {
+        const AbstractMetaArgumentList &arguments = func->arguments();
+        for (const AbstractMetaArgument *arg : arguments) {
+            if (func->argumentRemoved(arg->argumentIndex() + 1))
+                continue;
+            if (!func->typeReplaced(arg->argumentIndex() + 1).isEmpty()
+                || func->isModifiedToArray(arg->argumentIndex() + 1)) {
+                return false;
+            }
+            const AbstractMetaType *type = arg->type();
+            if (type->isContainer() || type->isArray() || type->isNativePointer()
+                || type->typeEntry()->isCustom()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Wraps the decisor by a lookup in a per call site cache keyed on the
+// argument types (see sbkoverloadcache.h).
+void CppGenerator::writeCachedOverloadedFunctionDecisorEngine(QTextStream &s,
+                                                              const OverloadData &overloadData)
+{
+    const AbstractMetaFunction *rfunc = overloadData.referenceFunction();
+    const int maxArgs = overloadData.maxArgs();
+    const bool usePyArgs = pythonFunctionWrapperUsesListOfArguments(overloadData);
+    // Mirrors the condition for declaring numArgs in writeMethodWrapperPreamble().
+    const bool hasNumArgs = rfunc->isConstructor()
+        || overloadData.minArgs() != maxArgs || maxArgs > 1;
+    const QString numArgs = hasNumArgs ? QLatin1String("numArgs") : QLatin1String("1");
+    const QString args = usePyArgs
+        ? QLatin1String(PYTHON_ARGS) : QLatin1String("&") + QLatin1String(PYTHON_ARG);
+    const QString converters = usePyArgs
+        ? QLatin1String(PYTHON_TO_CPP_VAR) : QLatin1String("&") + QLatin1String(PYTHON_TO_CPP_VAR);
+
+    s << INDENT << "static Shiboken::OverloadCache::Site<" << (usePyArgs ? maxArgs : 1)
+        << "> overloadCache;\n";
+    s << INDENT << "if (!overloadCache.lookup(" << numArgs << ", " << args
+        << ", &overloadId, " << converters << ")) {\n";
+    {
+        Indentation indent(INDENT);
+        writeOverloadedFunctionDecisorEngine(s, &overloadData);
+        s << INDENT << "if (overloadId != -1)\n";
+        Indentation indent2(INDENT);
+        s << INDENT << "overloadCache.store(" << numArgs << ", " << args
+            << ", overloadId, " << converters << ");\n";
+    }
+    s << INDENT << "}\n";
+}
+
 void CppGenerator::writeOverloadedFunctionDecisorEngine(QTextStream &s, const OverloadData *parentOverloadData)
 {
     bool hasDefaultCall = parentOverloadData->nextArgumentHasDefaultValue();
@@ -3244,13 +3571,16 @@ void CppGenerator::writePythonToCppConversionFunctions(QTextStream &s, const Abs
     s << Qt::endl;
 }
 
-void CppGenerator::writeAddPythonToCppConversion(QTextStream &s, const QString &converterVar, const QString &pythonToCppFunc, const QString &isConvertibleFunc)
+void CppGenerator::writeAddPythonToCppConversion(QTextStream &s, const QString &converterVar, const QString &pythonToCppFunc,
+                                                 const QString &isConvertibleFunc, bool checksTypeOnly)
 {
     s << INDENT << "Shiboken::Conversions::addPythonToCppValueConversion(" << converterVar << ',' << Qt::endl;
     {
         Indentation indent(INDENT);
         s << INDENT << pythonToCppFunc << ',' << Qt::endl;
         s << INDENT << isConvertibleFunc;
+        if (checksTypeOnly)
+            s << ',' << Qt::endl << INDENT << "true";
     }
     s << ");\n";
 }
@@ -3809,7 +4139,7 @@ void CppGenerator::writeMethodCall(QTextStream &s, const AbstractMetaFunction *f
             }
 
             if (refCount.action == ReferenceCount::Add || refCount.action == ReferenceCount::Set)
-                s << INDENT << "Shiboken::Object::keepReference(";
+                s << INDENT << "Shiboken::Object::keepStaticReference(";
             else
                 s << INDENT << "Shiboken::Object::removeReference(";
 
@@ -3857,13 +4187,13 @@ void CppGenerator::writeMultipleInheritanceInitializerFunction(QTextStream &s, c
 {
     QString className = metaClass->qualifiedCppName();
     const QStringList ancestors = getAncestorMultipleInheritance(metaClass);
-    s << "static int mi_offsets[] = { ";
-    for (int i = 0; i < ancestors.size(); i++)
-        s << "-1, ";
-    s << "-1 };\n";
     s << "int *\n";
     s << multipleInheritanceInitializerFunctionName(metaClass) << "(const void *cptr)\n";
     s << "{\n";
+    s << INDENT << "static int mi_offsets[] = { ";
+    for (int i = 0; i < ancestors.size(); i++)
+        s << "-1, ";
+    s << "-1 };\n";
     s << INDENT << "if (mi_offsets[0] == -1) {\n";
     {
         Indentation indent(INDENT);
@@ -4742,7 +5072,7 @@ void CppGenerator::writeSetterFunction(QTextStream &s,
     s << ";\n" << Qt::endl;
 
     if (isPointerToWrapperType(fieldType)) {
-        s << INDENT << "Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(self), \"";
+        s << INDENT << "Shiboken::Object::keepStaticReference(reinterpret_cast<SbkObject *>(self), \"";
         s << metaField->name() << "\", pyIn);\n";
     }
 
@@ -4958,6 +5288,11 @@ void CppGenerator::writeSignatureInfo(QTextStream &s, const AbstractMetaFunction
     int idx = overloads.length() - 1;
     bool multiple = idx > 0;
 
+    if (compactSignatures()) {
+        writeCompactSignatureInfo(s, funcName, overloads);
+        return;
+    }
+
     for (const AbstractMetaFunction *f : overloads) {
         QStringList args;
         // PYSIDE-1328: `self`-ness cannot be computed in Python because there are mixed cases.
@@ -4985,6 +5320,42 @@ void CppGenerator::writeSignatureInfo(QTextStream &s, const AbstractMetaFunction
     }
 }
 
+// Field separators of the compact signature format (ASCII unit/record separator).
+// They cannot occur in names, types or default expressions.
+static const char compactFieldSeparator = '\x1f';
+static const char compactArgumentSeparator = '\x1e';
+
+// Writes the signatures pre-split so that the signature module can use
+// str.split() instead of matching each line against regular expressions:
+//    [n:]funcname US [returntype] { US argname RS argtype [RS default] }
+void CppGenerator::writeCompactSignatureInfo(QTextStream &s, const QString &funcName,
+                                             const AbstractMetaFunctionList &overloads) const
+{
+    int idx = overloads.length() - 1;
+    const bool multiple = idx > 0;
+
+    for (const AbstractMetaFunction *f : overloads) {
+        if (multiple)
+            s << idx-- << ':';
+        s << funcName << compactFieldSeparator;
+        if (!f->isVoid())
+            s << f->type()->pythonSignature();
+        if (!(f->isStatic()) && f->ownerClass())
+            s << compactFieldSeparator << "self" << compactArgumentSeparator << "self";
+        const AbstractMetaArgumentList &arguments = f->arguments();
+        for (const AbstractMetaArgument *arg : arguments)  {
+            s << compactFieldSeparator << arg->name()
+                << compactArgumentSeparator << arg->type()->pythonSignature();
+            QString e = arg->defaultValueExpression();
+            if (!e.isEmpty()) {
+                e.replace(QLatin1String("::"), QLatin1String("."));
+                s << compactArgumentSeparator << e;
+            }
+        }
+        s << Qt::endl;
+    }
+}
+
 void CppGenerator::writeEnumsInitialization(QTextStream &s, AbstractMetaEnumList &enums)
 {
     if (enums.isEmpty())
@@ -5246,17 +5617,12 @@ void CppGenerator::writeFlagsBinaryOperator(QTextStream &s, const AbstractMetaEn
 
     AbstractMetaType *flagsType = buildAbstractMetaTypeFromTypeEntry(flagsEntry);
     s << INDENT << "::" << flagsEntry->originalName() << " cppResult, " << CPP_SELF_VAR << ", cppArg;\n";
-    s << "#ifdef IS_PY3K\n";
+    // Read the operands in place; going through int() would create
+    // temporary Python objects for every operation.
     s << INDENT << CPP_SELF_VAR << " = static_cast<::" << flagsEntry->originalName()
-        << ">(int(PyLong_AsLong(self)));\n";
-    s << INDENT << "cppArg = static_cast<" << flagsEntry->originalName() << ">(int(PyLong_AsLong("
-        << PYTHON_ARG << ")));\n";
-    s << "#else\n";
-    s << INDENT << CPP_SELF_VAR << " = static_cast<::" << flagsEntry->originalName()
-        << ">(int(PyInt_AsLong(self)));\n";
+        << ">(int(PySide::QFlags::getNumberValue(self)));\n";
     s << INDENT << "cppArg = static_cast<" << flagsEntry->originalName()
-        << ">(int(PyInt_AsLong(" << PYTHON_ARG << ")));\n";
-    s << "#endif\n\n";
+        << ">(int(PySide::QFlags::getNumberValue(" << PYTHON_ARG << ")));\n\n";
     s << INDENT << "if (PyErr_Occurred())\n" << indent(INDENT)
         << INDENT << "return nullptr;\n" << outdent(INDENT);
     s << INDENT << "cppResult = " << CPP_SELF_VAR << " " << cppOpName << " cppArg;\n";
@@ -5322,6 +5688,23 @@ void CppGenerator::writeSignatureStrings(QTextStream &s,
     s << "static const char *" << arrayName << "_SignatureStrings[] = {\n";
     QString line;
     while (signatureStream.readLineInto(&line)) {
+        if (compactSignatures()) {
+            // The separators need octal escapes, which raw strings do not support.
+            QString escaped;
+            escaped.reserve(line.size() + 16);
+            for (QChar c : qAsConst(line)) {
+                if (c == QLatin1Char(compactFieldSeparator))
+                    escaped += QLatin1String("\\037");
+                else if (c == QLatin1Char(compactArgumentSeparator))
+                    escaped += QLatin1String("\\036");
+                else if (c == QLatin1Char('"') || c == QLatin1Char('\\'))
+                    escaped += QLatin1Char('\\') + QString(c);
+                else
+                    escaped += c;
+            }
+            s << INDENT << '"' << escaped << "\",\n";
+            continue;
+        }
         // must anything be escaped?
         if (line.contains(QLatin1Char('"')) || line.contains(QLatin1Char('\\')))
             s << INDENT << "R\"CPP(" << line << ")CPP\",\n";
@@ -5849,7 +6232,69 @@ void CppGenerator::writeSmartPointerGetattroFunction(QTextStream &s, const Gener
 {
     Q_ASSERT(context.forSmartPointer());
     const AbstractMetaClass *metaClass = context.metaClass();
+    const AbstractMetaType *smartPointerType = context.preciseType();
+    const AbstractMetaType *innerType = smartPointerType->getSmartPointerInnerType();
+    const QString pointerToInnerTypeName = innerType->cppSignature() + QLatin1Char('*');
+    const AbstractMetaType *pointerToInnerType = isWrapperType(innerType)
+        ? buildAbstractMetaTypeFromString(pointerToInnerTypeName) : nullptr;
     writeGetattroDefinition(s, metaClass);
+    if (pointerToInnerType == nullptr) {
+        writeSmartPointerGetattroFallback(s);
+        return;
+    }
+
+    // Look up the attributes of the smart pointer itself without raising
+    // AttributeError, since most names accessed belong to the pointee.
+    s << INDENT << "auto ob_dict = reinterpret_cast<SbkObject *>(self)->ob_dict;\n";
+    s << INDENT << "if (Shiboken::ObjectType::lookupAttribute(Py_TYPE(self), name)\n";
+    s << INDENT << "    || (ob_dict && PyDict_GetItem(ob_dict, name))) {\n";
+    {
+        Indentation indent(INDENT);
+        s << INDENT << "return PyObject_GenericGetAttr(self, name);\n";
+    }
+    s << INDENT << "}\n";
+
+    // This generates the code which dispatches access to member functions
+    // and fields from the smart pointer to its pointee. The getter is called
+    // directly; the pointer conversion returns the existing wrapper of the
+    // pointee if there is one, and the attribute lookup on the pointee goes
+    // through its type's attribute cache.
+    const auto *typeEntry = static_cast<const SmartPointerTypeEntry *>(smartPointerType->typeEntry());
+    s << INDENT << "if (!Shiboken::Object::isValid(self))\n";
+    {
+        Indentation indent(INDENT);
+        s << INDENT << "return nullptr;\n";
+    }
+    s << INDENT << "auto " << CPP_SELF_VAR << " = " << cpythonWrapperCPtr(smartPointerType, QLatin1String("self"))
+      << ";\n";
+    s << INDENT << "PyObject *rawObj = ";
+    writeToPythonConversion(s, pointerToInnerType, metaClass,
+                            QLatin1String(CPP_SELF_VAR) + QLatin1String("->") + typeEntry->getter()
+                            + QLatin1String("()"));
+    s << ";\n";
+    s << INDENT << "if (!rawObj)\n";
+    {
+        Indentation indent(INDENT);
+        s << INDENT << "return nullptr;\n";
+    }
+    if (useReturnValueHeuristic())
+        s << INDENT << "Shiboken::Object::setParent(self, rawObj);\n";
+    s << INDENT << "PyObject *tmp = PyObject_GetAttr(rawObj, name);\n";
+    s << INDENT << "Py_DECREF(rawObj);\n";
+    s << INDENT << "if (!tmp && PyErr_ExceptionMatches(PyExc_AttributeError)) {\n";
+    {
+        Indentation indent(INDENT);
+        s << INDENT << "PyErr_Clear();\n";
+        writeSmartPointerAttributeError(s);
+    }
+    s << INDENT << "}\n";
+    s << INDENT << "return tmp;\n}\n\n";
+}
+
+// Generic dispatch through the getter method, used for pointees which are
+// not wrapped types.
+void CppGenerator::writeSmartPointerGetattroFallback(QTextStream &s)
+{
     s << INDENT << "PyObject *tmp = PyObject_GenericGetAttr(self, name);\n";
     s << INDENT << "if (tmp)\n";
     {
@@ -5863,8 +6308,6 @@ void CppGenerator::writeSmartPointerGetattroFunction(QTextStream &s, const Gener
     }
     s << INDENT << "PyErr_Clear();\n";
 
-    // This generates the code which dispatches access to member functions
-    // and fields from the smart pointer to its pointee.
     s << INDENT << "// Try to find the 'name' attribute, by retrieving the PyObject for "
                    "the corresponding C++ object held by the smart pointer.\n";
     s << INDENT << "if (auto rawObj = PyObject_CallMethod(self, "
@@ -5882,15 +6325,20 @@ void CppGenerator::writeSmartPointerGetattroFunction(QTextStream &s, const Gener
     s << INDENT << "if (!tmp) {\n";
     {
         Indentation indent(INDENT);
-        s << INDENT << "PyTypeObject *tp = Py_TYPE(self);\n";
-        s << INDENT << "PyErr_Format(PyExc_AttributeError,\n";
-        s << INDENT << "             \"'%.50s' object has no attribute '%.400s'\",\n";
-        s << INDENT << "             tp->tp_name, Shiboken::String::toCString(name));\n";
+        writeSmartPointerAttributeError(s);
     }
     s << INDENT << "}\n";
     s << INDENT << "return tmp;\n}\n\n";
 }
 
+void CppGenerator::writeSmartPointerAttributeError(QTextStream &s)
+{
+    s << INDENT << "PyTypeObject *tp = Py_TYPE(self);\n";
+    s << INDENT << "PyErr_Format(PyExc_AttributeError,\n";
+    s << INDENT << "             \"'%.50s' object has no attribute '%.400s'\",\n";
+    s << INDENT << "             tp->tp_name, Shiboken::String::toCString(name));\n";
+}
+
 // Write declaration and invocation of the init function for the module init
 // function.
 void CppGenerator::writeInitFunc(QTextStream &declStr, QTextStream &callStr,
@@ -6241,7 +6689,13 @@ bool CppGenerator::finishGeneration()
     s << "#else\n";
     s << INDENT << "PyObject *module = Shiboken::Module::create(\""  << moduleName() << "\", ";
     s << moduleName() << "_methods);\n";
-    s << "#endif\n\n";
+    s << "#endif\n";
+    s << INDENT << "if (module == nullptr)\n";
+    {
+        Indentation indent(INDENT);
+        s << INDENT << "return SBK_MODULE_INIT_ERROR;\n";
+    }
+    s << Qt::endl;
 
     s << INDENT << "using MODULE_NAMESPACE::" << pythonModuleObjectName() << ';' << Qt::endl;
 
@@ -6347,7 +6801,9 @@ bool CppGenerator::finishGeneration()
     s << "#" << INDENT << "pragma warning(pop)" << Qt::endl;
     s << "#endif" << Qt::endl;
 
-    return file.done() != FileOut::Failure;
+    if (file.done() == FileOut::Failure)
+        return false;
+    return unityBuildChunks() <= 0 || writeUnityBuildFiles();
 }
 
 static ArgumentOwner getArgumentOwner(const AbstractMetaFunction *func, int argIndex)
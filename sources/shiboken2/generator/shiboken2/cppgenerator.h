@@ -58,6 +58,10 @@ private:
                                 const AbstractMetaFunction *func);
     void writeDestructorNative(QTextStream &s, const GeneratorContext &classContext);
 
+    bool isUnityBuildMember(const GeneratorContext &classContext) const;
+    QString unityBuildFileName(int index) const;
+    bool writeUnityBuildFiles();
+
     QString getVirtualFunctionReturnTypeName(const AbstractMetaFunction *func);
     void writeVirtualMethodNative(QTextStream &s, const AbstractMetaFunction *func, int cacheIndex);
     void writeVirtualMethodCppCall(QTextStream &s, const AbstractMetaFunction *func,
@@ -89,6 +93,11 @@ private:
                                  const GeneratorContext &classContext);
     void writeMethodWrapper(QTextStream &s, const AbstractMetaFunctionList &overloads,
                             const GeneratorContext &classContext);
+    QString tableDrivenArgumentKindName(const AbstractMetaType *type) const;
+    bool isTableDrivenMethod(const OverloadData &overloadData,
+                             const GeneratorContext &context) const;
+    void writeTableDrivenMethodWrapper(QTextStream &s, const OverloadData &overloadData,
+                                       const GeneratorContext &context);
     void writeArgumentsInitializer(QTextStream &s, OverloadData &overloadData);
     void writeCppSelfConversion(QTextStream &s, const GeneratorContext &context,
                                 const QString &className, bool useWrapperClass);
@@ -121,6 +130,8 @@ private:
                                const GeneratorContext &context);
     static void writeGetattroDefinition(QTextStream &s, const AbstractMetaClass *metaClass);
     void writeSmartPointerGetattroFunction(QTextStream &s, const GeneratorContext &context);
+    void writeSmartPointerGetattroFallback(QTextStream &s);
+    static void writeSmartPointerAttributeError(QTextStream &s);
     void writeGetattroFunction(QTextStream &s, AttroCheck attroCheck,
                                const GeneratorContext &context);
     QString writeSmartPointerGetterCast();
@@ -189,6 +200,9 @@ private:
     void writeOverloadedFunctionDecisor(QTextStream &s, const OverloadData &overloadData);
     /// Recursive auxiliar method to the other writeOverloadedFunctionDecisor.
     void writeOverloadedFunctionDecisorEngine(QTextStream &s, const OverloadData *parentOverloadData);
+    /// Writes the decisor wrapped by a lookup in an inline cache (--enable-overload-cache).
+    void writeCachedOverloadedFunctionDecisorEngine(QTextStream &s, const OverloadData &overloadData);
+    static bool isOverloadDecisionCacheable(const OverloadData &overloadData);
 
     /// Writes calls to all the possible method/function overloads.
     void writeFunctionCalls(QTextStream &s,
@@ -245,7 +259,8 @@ private:
     /// Writes a pair of Python to C++ conversion and check functions for instantiated container types.
     void writePythonToCppConversionFunctions(QTextStream &s, const AbstractMetaType *containerType);
 
-    void writeAddPythonToCppConversion(QTextStream &s, const QString &converterVar, const QString &pythonToCppFunc, const QString &isConvertibleFunc);
+    void writeAddPythonToCppConversion(QTextStream &s, const QString &converterVar, const QString &pythonToCppFunc,
+                                       const QString &isConvertibleFunc, bool checksTypeOnly = false);
 
     void writeNamedArgumentResolution(QTextStream &s, const AbstractMetaFunction *func,
                                       bool usePyArgs, const OverloadData &overloadData);
@@ -271,6 +286,8 @@ private:
     void writeMethodDefinitionEntry(QTextStream &s, const AbstractMetaFunctionList &overloads);
     void writeMethodDefinition(QTextStream &s, const AbstractMetaFunctionList &overloads);
     void writeSignatureInfo(QTextStream &s, const AbstractMetaFunctionList &overloads);
+    void writeCompactSignatureInfo(QTextStream &s, const QString &funcName,
+                                   const AbstractMetaFunctionList &overloads) const;
     /// Writes the implementation of all methods part of python sequence protocol
     void writeSequenceMethods(QTextStream &s,
                               const AbstractMetaClass *metaClass,
@@ -398,6 +415,9 @@ private:
 
     static QString m_currentErrorCode;
 
+    // Wrapper files to be included by the amalgamated files (--unity-build).
+    QStringList m_unityBuildFiles;
+
     /// Helper class to set and restore the current error code.
     class ErrorCode {
     public:
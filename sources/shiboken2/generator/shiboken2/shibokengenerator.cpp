@@ -50,6 +50,10 @@ static const char ENABLE_PYSIDE_EXTENSIONS[] = "enable-pyside-extensions";
 static const char DISABLE_VERBOSE_ERROR_MESSAGES[] = "disable-verbose-error-messages";
 static const char USE_ISNULL_AS_NB_NONZERO[] = "use-isnull-as-nb_nonzero";
 static const char WRAPPER_DIAGNOSTICS[] = "wrapper-diagnostics";
+static const char ENABLE_OVERLOAD_CACHE[] = "enable-overload-cache";
+static const char COMPACT_SIGNATURES[] = "compact-signatures";
+static const char UNITY_BUILD[] = "unity-build";
+static const char TABLE_DRIVEN_WRAPPERS[] = "table-driven-wrappers";
 
 const char *CPP_ARG = "cppArg";
 const char *CPP_ARG_REMOVED = "removed_cppArg";
@@ -2618,10 +2622,22 @@ Generator::OptionDescriptions ShibokenGenerator::options() const
                      QLatin1String("If a class have an isNull() const method, it will be used to compute\n"
                                    "the value of boolean casts"))
         << qMakePair(QLatin1String(WRAPPER_DIAGNOSTICS),
-                     QLatin1String("Generate diagnostic code around wrappers"));
-}
-
-bool ShibokenGenerator::handleOption(const QString &key, const QString & /* value */)
+                     QLatin1String("Generate diagnostic code around wrappers"))
+        << qMakePair(QLatin1String(ENABLE_OVERLOAD_CACHE),
+                     QLatin1String("Cache the overload selected for the argument types of a call\n"
+                                   "in each function wrapper (inline cache)"))
+        << qMakePair(QLatin1String(COMPACT_SIGNATURES),
+                     QLatin1String("Emit the signature strings pre-split into fields so that\n"
+                                   "the signature module does not need to parse them"))
+        << qMakePair(QLatin1String(TABLE_DRIVEN_WRAPPERS),
+                     QLatin1String("Describe simple methods by tables interpreted by a shared dispatcher\n"
+                                   "in libshiboken instead of open-coded wrappers"))
+        << qMakePair(QLatin1String(UNITY_BUILD) + QLatin1String("=<n>"),
+                     QLatin1String("Additionally write the class wrappers grouped into <n> amalgamated\n"
+                                   "source files (<module>_unity_<i>.cpp) for unity builds"));
+}
+
+bool ShibokenGenerator::handleOption(const QString &key, const QString &value)
 {
     if (key == QLatin1String(PARENT_CTOR_HEURISTIC))
         return (m_useCtorHeuristic = true);
@@ -2637,6 +2653,22 @@ bool ShibokenGenerator::handleOption(const QString &key, const QString & /* valu
         return (m_avoidProtectedHack = true);
     if (key == QLatin1String(WRAPPER_DIAGNOSTICS))
         return (m_wrapperDiagnostics = true);
+    if (key == QLatin1String(ENABLE_OVERLOAD_CACHE))
+        return (m_useOverloadCache = true);
+    if (key == QLatin1String(COMPACT_SIGNATURES))
+        return (m_compactSignatures = true);
+    if (key == QLatin1String(TABLE_DRIVEN_WRAPPERS))
+        return (m_tableDrivenWrappers = true);
+    if (key == QLatin1String(UNITY_BUILD)) {
+        bool ok;
+        m_unityBuildChunks = value.toInt(&ok);
+        if (!ok || m_unityBuildChunks < 0) {
+            qCWarning(lcShiboken).noquote().nospace()
+                << "Invalid value \"" << value << "\" for --" << UNITY_BUILD;
+            m_unityBuildChunks = 0;
+        }
+        return true;
+    }
     return false;
 }
 
@@ -2743,6 +2775,26 @@ bool ShibokenGenerator::avoidProtectedHack() const
     return m_avoidProtectedHack;
 }
 
+bool ShibokenGenerator::useOverloadCache() const
+{
+    return m_useOverloadCache;
+}
+
+bool ShibokenGenerator::compactSignatures() const
+{
+    return m_compactSignatures;
+}
+
+bool ShibokenGenerator::useTableDrivenWrappers() const
+{
+    return m_tableDrivenWrappers;
+}
+
+int ShibokenGenerator::unityBuildChunks() const
+{
+    return m_unityBuildChunks;
+}
+
 QString ShibokenGenerator::moduleCppPrefix(const QString &moduleName) const
  {
     QString result = moduleName.isEmpty() ? packageName() : moduleName;
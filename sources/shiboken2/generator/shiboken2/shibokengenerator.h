@@ -389,6 +389,14 @@ protected:
     bool useIsNullAsNbNonZero() const;
     /// Returns true if the generated code should use the "#define protected public" hack.
     bool avoidProtectedHack() const;
+    /// Returns true if overload decisors should be wrapped by an inline cache keyed on argument types.
+    bool useOverloadCache() const;
+    /// Returns true if the signature strings should be emitted pre-split into fields.
+    bool compactSignatures() const;
+    /// Returns true if simple methods should be described by tables for the shared dispatcher.
+    bool useTableDrivenWrappers() const;
+    /// Returns the number of amalgamated wrapper files to write, 0 if unity builds are disabled.
+    int unityBuildChunks() const;
     QString cppApiVariableName(const QString &moduleName = QString()) const;
     QString pythonModuleObjectName(const QString &moduleName = QString()) const;
     QString convertersVariableName(const QString &moduleName = QString()) const;
@@ -575,6 +583,10 @@ private:
     bool m_useIsNullAsNbNonZero = false;
     bool m_avoidProtectedHack = false;
     bool m_wrapperDiagnostics = false;
+    bool m_useOverloadCache = false;
+    bool m_compactSignatures = false;
+    bool m_tableDrivenWrappers = false;
+    int m_unityBuildChunks = 0;
 
     using AbstractMetaTypeCache = QHash<QString, AbstractMetaType *>;
     AbstractMetaTypeCache m_metaTypeFromStringCache;
@@ -319,8 +319,8 @@ static int SbkObject_traverse(PyObject *self, visitproc visit, void *arg)
     //Visit refs
     Shiboken::RefCountMap *rInfo = sbkSelf->d->referredObjects;
     if (rInfo) {
-        for (auto it = rInfo->begin(), end = rInfo->end(); it != end; ++it)
-            Py_VISIT(it->second);
+        for (const Shiboken::ReferredObject &r : *rInfo)
+            Py_VISIT(r.object);
     }
 
     if (sbkSelf->ob_dict)
@@ -385,13 +385,6 @@ SbkObjectType *SbkObject_TypeF(void)
     return reinterpret_cast<SbkObjectType *>(type);
 }
 
-static int mainThreadDeletionHandler(void *)
-{
-    if (Py_IsInitialized())
-        Shiboken::BindingManager::instance().runDeletionInMainThread();
-    return 0;
-}
-
 static void SbkDeallocWrapperCommon(PyObject *pyObj, bool canDelete)
 {
     auto *sbkObj = reinterpret_cast<SbkObject *>(pyObj);
@@ -456,7 +449,6 @@ static void SbkDeallocWrapperCommon(PyObject *pyObj, bool canDelete)
                 Shiboken::DestructorEntry e{sotp->cpp_dtor, sbkObj->d->cptr[0]};
                 bindingManager.addToDeletionInMainThread(e);
             }
-            Py_AddPendingCall(mainThreadDeletionHandler, nullptr);
             canDelete = false;
         }
     }
@@ -530,6 +522,8 @@ void SbkObjectTypeDealloc(PyObject *pyObj)
         }
         free(sotp->original_name);
         sotp->original_name = nullptr;
+        delete sotp->mi_index;
+        sotp->mi_index = nullptr;
         if (!Shiboken::ObjectType::isUserType(type))
             Shiboken::Conversions::deleteConverter(sotp->converter);
         delete sotp;
@@ -760,6 +754,7 @@ static PyObject *SbkObjectTypeTpNew(PyTypeObject *metatype, PyObject *args, PyOb
         sotp->type_discovery = nullptr;
         sotp->cpp_dtor = nullptr;
         sotp->is_multicpp = 1;
+        sotp->mi_index = new Shiboken::MultiCppIndex(bases);
         sotp->converter = nullptr;
     }
     if (bases.size() == 1)
@@ -912,7 +907,7 @@ void _destroyParentInfo(SbkObject *obj, bool keepReference)
     Shiboken::ParentInfo *pInfo = obj->d->parentInfo;
     if (pInfo) {
         while(!pInfo->children.empty()) {
-            SbkObject *first = *pInfo->children.begin();
+            SbkObject *first = pInfo->children.front();
             // Mark child as invalid
             Shiboken::Object::invalidate(first);
             Shiboken::Object::removeParent(first, false, keepReference);
@@ -925,6 +920,43 @@ void _destroyParentInfo(SbkObject *obj, bool keepReference)
 
 namespace Shiboken
 {
+void ChildrenList::append(SbkObject *child)
+{
+    ParentInfo *pInfo = child->d->parentInfo;
+    pInfo->previousSibling = m_last;
+    pInfo->nextSibling = nullptr;
+    if (m_last)
+        m_last->d->parentInfo->nextSibling = child;
+    else
+        m_first = child;
+    m_last = child;
+    ++m_size;
+}
+
+void ChildrenList::remove(SbkObject *child)
+{
+    ParentInfo *pInfo = child->d->parentInfo;
+    if (pInfo->previousSibling)
+        pInfo->previousSibling->d->parentInfo->nextSibling = pInfo->nextSibling;
+    else
+        m_first = pInfo->nextSibling;
+    if (pInfo->nextSibling)
+        pInfo->nextSibling->d->parentInfo->previousSibling = pInfo->previousSibling;
+    else
+        m_last = pInfo->previousSibling;
+    pInfo->previousSibling = pInfo->nextSibling = nullptr;
+    --m_size;
+}
+
+std::vector<SbkObject *> ChildrenList::toVector() const
+{
+    std::vector<SbkObject *> result;
+    result.reserve(m_size);
+    for (SbkObject *child : *this)
+        result.push_back(child);
+    return result;
+}
+
 bool walkThroughClassHierarchy(PyTypeObject *currentType, HierarchyVisitor *visitor)
 {
     PyObject *bases = currentType->tp_bases;
@@ -964,6 +996,22 @@ bool GetIndexVisitor::visit(SbkObjectType *node)
     return PyType_IsSubtype(reinterpret_cast<PyTypeObject *>(node), m_desiredType);
 }
 
+MultiCppIndex::MultiCppIndex(const std::vector<SbkObjectType *> &bases) :
+    baseCount(int(bases.size()))
+{
+    // A walk with GetIndexVisitor stops at the first base which is a subtype
+    // of the desired type, so the first occurrence in the MROs wins.
+    for (int i = 0; i < baseCount; ++i) {
+        PyObject *mro = reinterpret_cast<PyTypeObject *>(bases[i])->tp_mro;
+        for (Py_ssize_t m = 0, size = PyTuple_GET_SIZE(mro); m < size; ++m) {
+            auto type = reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(mro, m));
+            auto known = [type](const std::pair<PyTypeObject *, int> &e) { return e.first == type; };
+            if (std::none_of(typeIndexes.cbegin(), typeIndexes.cend(), known))
+                typeIndexes.emplace_back(type, i);
+        }
+    }
+}
+
 bool DtorAccumulatorVisitor::visit(SbkObjectType *node)
 {
     m_entries.push_back(DestructorEntry{PepType_SOTP(node)->cpp_dtor,
@@ -1047,13 +1095,6 @@ std::vector<SbkObject *> splitPyObject(PyObject *pyObj)
     return result;
 }
 
-template <class Iterator>
-inline void decRefPyObjectList(Iterator i1, Iterator i2)
-{
-    for (; i1 != i2; ++i1)
-        Py_DECREF(i1->second);
-}
-
 namespace ObjectType
 {
 
@@ -1296,6 +1337,21 @@ void introduceProperty(SbkObjectType* instanceType,
      */
 }
 
+PyObject *lookupAttribute(PyTypeObject *type, PyObject *name)
+{
+    PyObject *mro = type->tp_mro;
+    if (mro == nullptr)
+        return type->tp_dict != nullptr ? PyDict_GetItem(type->tp_dict, name) : nullptr;
+    for (Py_ssize_t i = 0, size = PyTuple_GET_SIZE(mro); i < size; ++i) {
+        auto base = reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(mro, i));
+        if (base->tp_dict != nullptr) {
+            if (PyObject *result = PyDict_GetItem(base->tp_dict, name))
+                return result;
+        }
+    }
+    return nullptr;
+}
+
 } // namespace ObjectType
 
 
@@ -1498,7 +1554,7 @@ static void recursive_invalidate(SbkObject *self, std::set<SbkObject *> &seen)
     // If it is a parent invalidate all children.
     if (self->d->parentInfo) {
         // Create a copy because this list can be changed during the process
-        ChildrenList copy = self->d->parentInfo->children;
+        const std::vector<SbkObject *> copy = self->d->parentInfo->children.toVector();
 
         for (SbkObject *child : copy) {
             // invalidate the child
@@ -1512,9 +1568,8 @@ static void recursive_invalidate(SbkObject *self, std::set<SbkObject *> &seen)
 
     // If has ref to other objects invalidate all
     if (self->d->referredObjects) {
-        RefCountMap &refCountMap = *(self->d->referredObjects);
-        for (auto it = refCountMap.begin(), end = refCountMap.end(); it != end; ++it)
-            recursive_invalidate(it->second, seen);
+        for (const ReferredObject &r : *self->d->referredObjects)
+            recursive_invalidate(r.object, seen);
     }
 }
 
@@ -1535,11 +1590,9 @@ void makeValid(SbkObject *self)
 
     // If has ref to other objects make all valid again
     if (self->d->referredObjects) {
-        RefCountMap &refCountMap = *(self->d->referredObjects);
-        RefCountMap::iterator iter;
-        for (auto it = refCountMap.begin(), end = refCountMap.end(); it != end; ++it) {
-            if (Shiboken::Object::checkType(it->second))
-                makeValid(reinterpret_cast<SbkObject *>(it->second));
+        for (const ReferredObject &r : *self->d->referredObjects) {
+            if (Shiboken::Object::checkType(r.object))
+                makeValid(reinterpret_cast<SbkObject *>(r.object));
         }
     }
 }
@@ -1652,7 +1705,7 @@ SbkObject *findColocatedChild(SbkObject *wrapper,
     if (!pInfo)
         return nullptr;
 
-    ChildrenList &children = pInfo->children;
+    const ChildrenList &children = pInfo->children;
 
     for (SbkObject *child : children) {
         if (!(child->d && child->d->cptr))
@@ -1775,13 +1828,8 @@ void removeParent(SbkObject *child, bool giveOwnershipBack, bool keepReference)
         return;
     }
 
-    ChildrenList &oldBrothers = pInfo->parent->d->parentInfo->children;
-    // Verify if this child is part of parent list
-    auto iChild = oldBrothers.find(child);
-    if (iChild == oldBrothers.end())
-        return;
-
-    oldBrothers.erase(iChild);
+    // A child with a parent is always linked into the children list of the parent.
+    pInfo->parent->d->parentInfo->children.remove(child);
 
     pInfo->parent = nullptr;
 
@@ -1853,7 +1901,7 @@ void setParent(PyObject *parent, PyObject *child)
             pInfo = child_->d->parentInfo = new ParentInfo;
 
         pInfo->parent = parent_;
-        parent_->d->parentInfo->children.insert(child_);
+        parent_->d->parentInfo->children.append(child_);
 
         // Add Parent ref
         Py_INCREF(child_);
@@ -1866,6 +1914,40 @@ void setParent(PyObject *parent, PyObject *child)
     Py_DECREF(child);
 }
 
+void releaseChildren(SbkObject *parent, PyTypeObject *childType, bool invalidateChildren,
+                     ReleaseChildFilter filter, void *context)
+{
+    ParentInfo *pInfo = parent->d->parentInfo;
+    if (!pInfo || pInfo->children.empty())
+        return;
+
+    // Unlink the matching children first, then release them, since dropping
+    // the parent reference may run arbitrary code.
+    std::vector<SbkObject *> released;
+    released.reserve(pInfo->children.size());
+    for (SbkObject *child : pInfo->children.toVector()) {
+        if (childType && !PyObject_TypeCheck(reinterpret_cast<PyObject *>(child), childType))
+            continue;
+        if (filter) {
+            void *cppChild = childType ? cppPointer(child, childType)
+                : (child->d->cptr ? child->d->cptr[0] : nullptr);
+            if (!filter(cppChild, context))
+                continue;
+        }
+        pInfo->children.remove(child);
+        child->d->parentInfo->parent = nullptr;
+        released.push_back(child);
+    }
+
+    for (SbkObject *child : released) {
+        if (invalidateChildren)
+            invalidate(child);
+        // Transfer ownership back to Python and remove parent ref
+        child->d->hasOwnership = true;
+        Py_DECREF(child);
+    }
+}
+
 void deallocData(SbkObject *self, bool cleanup)
 {
     // Make cleanup if this is not a wrapper otherwise this will be done on wrapper destructor
@@ -1913,18 +1995,35 @@ static inline bool isNone(const PyObject *o)
     return o == nullptr || o == Py_None;
 }
 
+// Keys emitted by the generator are string literals, so identical keys
+// mostly share the pointer; the comparison falls back to the contents for
+// keys from other translation units or transient ones.
+static inline bool isSameRefCountKey(const char *k1, const char *k2)
+{
+    return k1 == k2 || std::strcmp(k1, k2) == 0;
+}
+
 static void removeRefCountKey(SbkObject *self, const char *key)
 {
-    if (self->d->referredObjects) {
-        const auto iterPair = self->d->referredObjects->equal_range(key);
-        if (iterPair.first != iterPair.second) {
-            decRefPyObjectList(iterPair.first, iterPair.second);
-            self->d->referredObjects->erase(iterPair.first, iterPair.second);
+    RefCountMap *refCountMap = self->d->referredObjects;
+    if (!refCountMap)
+        return;
+    // Erase before decrementing, since deleting a referred object may
+    // recurse into this list; search again afterwards for that reason.
+    for (auto it = refCountMap->begin(); it != refCountMap->end(); ) {
+        if (isSameRefCountKey(it->key, key)) {
+            PyObject *object = it->object;
+            refCountMap->erase(it);
+            Py_DECREF(object);
+            it = refCountMap->begin();
+        } else {
+            ++it;
         }
     }
 }
 
-void keepReference(SbkObject *self, const char *key, PyObject *referredObject, bool append)
+static void keepReferenceHelper(SbkObject *self, const char *key, PyObject *referredObject,
+                                bool append, bool staticKey)
 {
     if (isNone(referredObject)) {
         removeRefCountKey(self, key);
@@ -1932,26 +2031,38 @@ void keepReference(SbkObject *self, const char *key, PyObject *referredObject, b
     }
 
     if (!self->d->referredObjects) {
-        self->d->referredObjects =
-            new Shiboken::RefCountMap{RefCountMap::value_type{key, referredObject}};
-        Py_INCREF(referredObject);
-        return;
+        self->d->referredObjects = new Shiboken::RefCountMap;
+        self->d->referredObjects->reserve(4);
     }
 
     RefCountMap &refCountMap = *(self->d->referredObjects);
-    const auto iterPair = refCountMap.equal_range(key);
-    if (std::any_of(iterPair.first, iterPair.second,
-                    [referredObject](const RefCountMap::value_type &v) { return v.second == referredObject; })) {
-        return;
+    for (const ReferredObject &r : refCountMap) {
+        if (r.object == referredObject && isSameRefCountKey(r.key, key))
+            return;
     }
 
-    if (!append && iterPair.first != iterPair.second) {
-        decRefPyObjectList(iterPair.first, iterPair.second);
-        refCountMap.erase(iterPair.first, iterPair.second);
+    Py_INCREF(referredObject);
+    if (!append)
+        removeRefCountKey(self, key);
+
+    ReferredObject entry{key, referredObject, nullptr};
+    if (!staticKey) {
+        const size_t size = std::strlen(key) + 1;
+        entry.ownedKey.reset(new char[size]);
+        std::memcpy(entry.ownedKey.get(), key, size);
+        entry.key = entry.ownedKey.get();
     }
+    self->d->referredObjects->push_back(std::move(entry));
+}
 
-    refCountMap.insert(RefCountMap::value_type{key, referredObject});
-    Py_INCREF(referredObject);
+void keepReference(SbkObject *self, const char *key, PyObject *referredObject, bool append)
+{
+    keepReferenceHelper(self, key, referredObject, append, false);
+}
+
+void keepStaticReference(SbkObject *self, const char *key, PyObject *referredObject, bool append)
+{
+    keepReferenceHelper(self, key, referredObject, append, true);
 }
 
 void removeReference(SbkObject *self, const char *key, PyObject *referredObject)
@@ -1965,10 +2076,10 @@ void clearReferences(SbkObject *self)
     if (!self->d->referredObjects)
         return;
 
-    RefCountMap &refCountMap = *(self->d->referredObjects);
-    for (auto it = refCountMap.begin(), end = refCountMap.end(); it != end; ++it)
-        Py_DECREF(it->second);
-    self->d->referredObjects->clear();
+    RefCountMap removed;
+    removed.swap(*self->d->referredObjects);
+    for (const ReferredObject &r : removed)
+        Py_DECREF(r.object);
 }
 
 std::string info(SbkObject *self)
@@ -2017,15 +2128,15 @@ std::string info(SbkObject *self)
     if (self->d->referredObjects && !self->d->referredObjects->empty()) {
         Shiboken::RefCountMap &map = *self->d->referredObjects;
         s << "referred objects.. ";
-        std::string lastKey;
-        for (auto it = map.begin(), end = map.end(); it != end; ++it) {
-            if (it->first != lastKey) {
-                if (!lastKey.empty())
+        const char *lastKey = nullptr;
+        for (const ReferredObject &r : map) {
+            if (lastKey == nullptr || !isSameRefCountKey(r.key, lastKey)) {
+                if (lastKey != nullptr)
                     s << "                   ";
-                s << '"' << it->first << "\" => ";
-                lastKey = it->first;
+                s << '"' << r.key << "\" => ";
+                lastKey = r.key;
             }
-            Shiboken::AutoDecRef obj(PyObject_Str(it->second));
+            Shiboken::AutoDecRef obj(PyObject_Str(r.object));
             s << String::toCString(obj) << ' ';
         }
         s << '\n';
@@ -292,6 +292,14 @@ LIBSHIBOKEN_API void        introduceProperty(SbkObjectType* instanceType,
                                               const char* getterName,
                                               const char* setterName = nullptr,
                                               bool generateAccessors = false);
+
+/**
+ *   Looks up \p name in the dictionaries of \p type and its bases in method resolution
+ *   order, as PyObject_GenericGetAttr() does before considering the instance dictionary.
+ *   Unlike PyObject_GetAttr(), no exception is set when the attribute is not found.
+ *   \returns a borrowed reference to the attribute, or nullptr.
+ */
+LIBSHIBOKEN_API PyObject *lookupAttribute(PyTypeObject *type, PyObject *name);
 }
 
 namespace Object {
@@ -442,6 +450,24 @@ LIBSHIBOKEN_API void setParent(PyObject *parent, PyObject *child);
 */
 LIBSHIBOKEN_API void removeParent(SbkObject *child, bool giveOwnershipBack = true, bool keepReferenc = false);
 
+/// Filter for releaseChildren(), called with the C++ pointer of a child.
+using ReleaseChildFilter = bool (*)(void *cppChild, void *context);
+
+/**
+*   Remove the children of \p parent from its control in one pass, as
+*   setParent(nullptr, child) does for a single child.
+*   \param parent the parent object.
+*   \param childType if not null, only instances of this type are released.
+*   \param invalidateChildren mark the released children as invalid, used when
+*          the C++ side is about to delete them.
+*   \param filter if not null, only children for which it returns true are released.
+*   \param context passed to \p filter.
+*/
+LIBSHIBOKEN_API void releaseChildren(SbkObject *parent, PyTypeObject *childType = nullptr,
+                                     bool invalidateChildren = false,
+                                     ReleaseChildFilter filter = nullptr,
+                                     void *context = nullptr);
+
 /**
  * Mark the object as invalid
  */
@@ -488,6 +514,13 @@ LIBSHIBOKEN_API void *getTypeUserData(SbkObject *wrapper);
  */
 LIBSHIBOKEN_API void keepReference(SbkObject *self, const char *key, PyObject *referredObject, bool append = false);
 
+/**
+ *   Same as keepReference(), but \p key must have static storage duration (typically a
+ *   string literal emitted by the generator). It is stored without being copied, and
+ *   lookups with the same pointer do not need to compare the string contents.
+ */
+LIBSHIBOKEN_API void keepStaticReference(SbkObject *self, const char *key, PyObject *referredObject, bool append = false);
+
 /**
  *   Removes any reference previously added by keepReference function
  *   \param self            the wrapper instance that keeps references to other objects.
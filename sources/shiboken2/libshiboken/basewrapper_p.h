@@ -44,6 +44,7 @@
 #include "basewrapper.h"
 
 #include <unordered_map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -54,14 +55,93 @@ struct SbkConverter;
 
 namespace Shiboken
 {
+/// Entry of RefCountMap.
+struct ReferredObject
+{
+    /// Key identifying the method and argument; either a string with static
+    /// storage duration or ownedKey.
+    const char *key;
+    PyObject *object;
+    /// Copy of a key passed to keepReference(), which may be transient.
+    std::unique_ptr<char[]> ownedKey;
+};
+
 /**
     * This mapping associates a method and argument of an wrapper object with the wrapper of
     * said argument when it needs the binding to help manage its reference count.
+    * Objects rarely refer to more than a few others, so this is a flat list compared by
+    * key pointer first; it is only allocated when the first reference is kept.
     */
-using RefCountMap = std::unordered_multimap<std::string, PyObject *> ;
+using RefCountMap = std::vector<ReferredObject>;
 
-/// Linked list of SbkBaseWrapper pointers
-using ChildrenList = std::set<SbkObject *>;
+/**
+ * Intrusive doubly-linked list of SbkBaseWrapper pointers.
+ * The links are stored in the ParentInfo of each child, so that adding and
+ * removing a child neither allocates nor searches. A child is a member of the
+ * list of its ParentInfo::parent.
+ */
+class ChildrenList
+{
+public:
+    class const_iterator
+    {
+    public:
+        explicit const_iterator(SbkObject *node) : m_node(node) {}
+        SbkObject *operator*() const { return m_node; }
+        inline const_iterator &operator++();
+        bool operator!=(const const_iterator &other) const { return m_node != other.m_node; }
+        bool operator==(const const_iterator &other) const { return m_node == other.m_node; }
+
+    private:
+        SbkObject *m_node;
+    };
+
+    ChildrenList() = default;
+    ChildrenList(const ChildrenList &) = delete;
+    ChildrenList &operator=(const ChildrenList &) = delete;
+
+    bool empty() const { return m_first == nullptr; }
+    std::size_t size() const { return m_size; }
+    SbkObject *front() const { return m_first; }
+
+    const_iterator begin() const { return const_iterator(m_first); }
+    const_iterator end() const { return const_iterator(nullptr); }
+
+    /// Appends \p child, whose ParentInfo must exist and not be linked.
+    void append(SbkObject *child);
+    /// Unlinks \p child, which must be a member of this list.
+    void remove(SbkObject *child);
+    /// Copies the children into a vector, for iterations that modify the list.
+    std::vector<SbkObject *> toVector() const;
+
+private:
+    SbkObject *m_first = nullptr;
+    SbkObject *m_last = nullptr;
+    std::size_t m_size = 0;
+};
+
+/**
+ * Maps the types of the C++ base classes of a multiple inheritance wrapper
+ * type and their ancestors to the index of the matching C++ pointer, as
+ * returned by a walk over the class hierarchy with GetIndexVisitor.
+ * It is computed once when the type is created.
+ */
+struct MultiCppIndex
+{
+    explicit MultiCppIndex(const std::vector<SbkObjectType *> &bases);
+
+    int indexOf(PyTypeObject *desiredType) const
+    {
+        for (const auto &entry : typeIndexes) {
+            if (entry.first == desiredType)
+                return entry.second;
+        }
+        return baseCount - 1; // Like GetIndexVisitor when nothing matches
+    }
+
+    std::vector<std::pair<PyTypeObject *, int> > typeIndexes;
+    int baseCount;
+};
 
 /// Structure used to store information about object parent and children.
 struct ParentInfo
@@ -70,6 +150,9 @@ struct ParentInfo
     ParentInfo() : parent(nullptr), hasWrapperRef(false) {}
     /// Pointer to parent object.
     SbkObject *parent;
+    /// Siblings in the children list of the parent.
+    SbkObject *previousSibling = nullptr;
+    SbkObject *nextSibling = nullptr;
     /// List of object children.
     ChildrenList children;
     /// has internal ref
@@ -114,6 +197,22 @@ struct SbkObjectPrivate
     }
 };
 
+} // extern "C"
+
+namespace Shiboken
+{
+
+ChildrenList::const_iterator &ChildrenList::const_iterator::operator++()
+{
+    m_node = m_node->d->parentInfo->nextSibling;
+    return *this;
+}
+
+} // namespace Shiboken
+
+extern "C"
+{
+
 // TODO-CONVERTERS: to be deprecated/removed
 /// The type behaviour was not defined yet
 #define BEHAVIOUR_UNDEFINED 0
@@ -150,6 +249,8 @@ struct SbkObjectTypePrivate
     DeleteUserDataFunc d_func;
     void (*subtype_init)(SbkObjectType *, PyObject *, PyObject *);
     const char **propertyStrings;
+    /// Index of the C++ pointers for types with is_multicpp set, may be null.
+    Shiboken::MultiCppIndex *mi_index;
 };
 
 
@@ -256,6 +357,8 @@ bool walkThroughClassHierarchy(PyTypeObject *currentType, HierarchyVisitor *visi
 
 inline int getTypeIndexOnHierarchy(PyTypeObject *baseType, PyTypeObject *desiredType)
 {
+    if (const MultiCppIndex *index = PepType_SOTP(baseType)->mi_index)
+        return index->indexOf(desiredType);
     GetIndexVisitor visitor(desiredType);
     walkThroughClassHierarchy(baseType, &visitor);
     return visitor.index();
@@ -263,6 +366,8 @@ inline int getTypeIndexOnHierarchy(PyTypeObject *baseType, PyTypeObject *desired
 
 inline int getNumberOfCppBaseClasses(PyTypeObject *baseType)
 {
+    if (const MultiCppIndex *index = PepType_SOTP(baseType)->mi_index)
+        return index->baseCount;
     BaseCountVisitor visitor;
     walkThroughClassHierarchy(baseType, &visitor);
     return visitor.count();
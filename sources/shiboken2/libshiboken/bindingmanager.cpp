@@ -47,9 +47,11 @@
 #include "sbkstaticstrings.h"
 #include "debugfreehook.h"
 
+#include <atomic>
 #include <cstddef>
 #include <fstream>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace Shiboken
 {
@@ -137,17 +139,29 @@ static void showWrapperMap(const WrapperMap &wrapperMap)
 }
 #endif
 
-struct BindingManager::BindingManagerPrivate {
-    using DestructorEntries = std::vector<DestructorEntry>;
+// Node of the lock-free queue of destructors to be run in the main thread.
+struct DeletionInMainThreadNode
+{
+    DestructorEntry entry;
+    DeletionInMainThreadNode *next;
+};
 
+struct BindingManager::BindingManagerPrivate {
     WrapperMap wrapperMapper;
     Graph classHierarchy;
-    DestructorEntries deleteInMainThread;
+    // Threads push onto this intrusive stack with compare-and-swap; the main
+    // thread takes all of it at once, so no locking is needed.
+    std::atomic<DeletionInMainThreadNode *> deleteInMainThread;
+    DeletionInMainThreadNotifier deletionNotifier;
+    // Live wrappers of indexedType, see BindingManager::indexWrappersOfType().
+    PyTypeObject *indexedType;
+    std::unordered_set<SbkObject *> indexedWrappers;
     bool destroying;
 
-    BindingManagerPrivate() : destroying(false) {}
+    BindingManagerPrivate() : deleteInMainThread(nullptr), deletionNotifier(nullptr),
+        indexedType(nullptr), destroying(false) {}
     bool releaseWrapper(void *cptr, SbkObject *wrapper);
-    void assignWrapper(SbkObject *wrapper, const void *cptr);
+    bool assignWrapper(SbkObject *wrapper, const void *cptr);
 
 };
 
@@ -164,12 +178,12 @@ bool BindingManager::BindingManagerPrivate::releaseWrapper(void *cptr, SbkObject
     return false;
 }
 
-void BindingManager::BindingManagerPrivate::assignWrapper(SbkObject *wrapper, const void *cptr)
+// Returns whether the wrapper was inserted, that is, whether no other wrapper
+// is registered for the address.
+bool BindingManager::BindingManagerPrivate::assignWrapper(SbkObject *wrapper, const void *cptr)
 {
     assert(cptr);
-    auto iter = wrapperMapper.find(cptr);
-    if (iter == wrapperMapper.end())
-        wrapperMapper.insert(std::make_pair(cptr, wrapper));
+    return wrapperMapper.insert(std::make_pair(cptr, wrapper)).second;
 }
 
 BindingManager::BindingManager()
@@ -198,6 +212,13 @@ BindingManager::~BindingManager()
         }
         assert(m_d->wrapperMapper.empty());
     }
+    // Destructors still pending are not run at this stage.
+    auto *node = m_d->deleteInMainThread.exchange(nullptr);
+    while (node) {
+        auto *next = node->next;
+        delete node;
+        node = next;
+    }
     delete m_d;
 }
 
@@ -221,7 +242,10 @@ void BindingManager::registerWrapper(SbkObject *pyObj, void *cptr)
 
     if (d->mi_init && !d->mi_offsets)
         d->mi_offsets = d->mi_init(cptr);
-    m_d->assignWrapper(pyObj, cptr);
+    if (m_d->assignWrapper(pyObj, cptr)
+        && m_d->indexedType && PyObject_TypeCheck(pyObj, m_d->indexedType)) {
+        m_d->indexedWrappers.insert(pyObj);
+    }
     if (d->mi_offsets) {
         int *offset = d->mi_offsets;
         while (*offset != -1) {
@@ -238,6 +262,8 @@ void BindingManager::releaseWrapper(SbkObject *sbkObj)
     SbkObjectTypePrivate *d = PepType_SOTP(sbkType);
     int numBases = ((d && d->is_multicpp) ? getNumberOfCppBaseClasses(Py_TYPE(sbkObj)) : 1);
 
+    if (m_d->indexedType)
+        m_d->indexedWrappers.erase(sbkObj);
     void ** cptrs = reinterpret_cast<SbkObject *>(sbkObj)->d->cptr;
     for (int i = 0; i < numBases; ++i) {
         auto *cptr = reinterpret_cast<unsigned char *>(cptrs[i]);
@@ -256,14 +282,52 @@ void BindingManager::releaseWrapper(SbkObject *sbkObj)
 
 void BindingManager::runDeletionInMainThread()
 {
-    for (const DestructorEntry &e : m_d->deleteInMainThread)
-        e.destructor(e.cppInstance);
-    m_d->deleteInMainThread.clear();
+    // Take the whole batch and restore the order in which it was queued.
+    auto *node = m_d->deleteInMainThread.exchange(nullptr, std::memory_order_acquire);
+    DeletionInMainThreadNode *batch = nullptr;
+    while (node) {
+        auto *next = node->next;
+        node->next = batch;
+        batch = node;
+        node = next;
+    }
+    while (batch) {
+        auto *next = batch->next;
+        batch->entry.destructor(batch->entry.cppInstance);
+        delete batch;
+        batch = next;
+    }
+}
+
+static int mainThreadDeletionHandler(void *)
+{
+    if (Py_IsInitialized())
+        BindingManager::instance().runDeletionInMainThread();
+    return 0;
 }
 
 void BindingManager::addToDeletionInMainThread(const DestructorEntry &e)
 {
-    m_d->deleteInMainThread.push_back(e);
+    auto *node = new DeletionInMainThreadNode{e, m_d->deleteInMainThread.load(std::memory_order_relaxed)};
+    while (!m_d->deleteInMainThread.compare_exchange_weak(node->next, node,
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed)) {
+    }
+    // Only the entry starting a batch schedules the main thread; the
+    // entries queued until it runs are deleted together. The pending call
+    // is always added since the notifier's event loop might not be running
+    // (a script without exec()); whichever runs first drains the batch and
+    // the other one finds it empty.
+    if (node->next == nullptr) {
+        if (DeletionInMainThreadNotifier notifier = m_d->deletionNotifier)
+            notifier();
+        Py_AddPendingCall(mainThreadDeletionHandler, nullptr);
+    }
+}
+
+void BindingManager::setDeletionInMainThreadNotifier(DeletionInMainThreadNotifier notifier)
+{
+    m_d->deletionNotifier = notifier;
 }
 
 SbkObject *BindingManager::retrieveWrapper(const void *cptr)
@@ -363,10 +427,44 @@ std::set<PyObject *> BindingManager::getAllPyObjects()
 
 void BindingManager::visitAllPyObjects(ObjectVisitor visitor, void *data)
 {
-    WrapperMap copy = m_d->wrapperMapper;
-    for (auto it = copy.begin(); it != copy.end(); ++it) {
-        if (hasWrapper(it->first))
-            visitor(it->second, data);
+    visitPyObjects(nullptr, visitor, data);
+}
+
+void BindingManager::visitPyObjects(PyTypeObject *type, ObjectVisitor visitor, void *data)
+{
+    // The visitor may release wrappers, so work on a snapshot of the
+    // matching entries and skip those which are gone when their turn comes.
+    if (type != nullptr && type == m_d->indexedType) {
+        const std::vector<SbkObject *> wrappers(m_d->indexedWrappers.cbegin(),
+                                                m_d->indexedWrappers.cend());
+        for (SbkObject *wrapper : wrappers) {
+            if (m_d->indexedWrappers.count(wrapper) != 0)
+                visitor(wrapper, data);
+        }
+        return;
+    }
+
+    std::vector<WrapperMap::value_type> entries;
+    for (const auto &entry : m_d->wrapperMapper) {
+        if (type == nullptr || PyObject_TypeCheck(entry.second, type))
+            entries.push_back(entry);
+    }
+    for (const auto &entry : entries) {
+        auto it = m_d->wrapperMapper.find(entry.first);
+        if (it != m_d->wrapperMapper.end() && it->second == entry.second)
+            visitor(entry.second, data);
+    }
+}
+
+void BindingManager::indexWrappersOfType(PyTypeObject *type)
+{
+    m_d->indexedType = type;
+    m_d->indexedWrappers.clear();
+    if (type == nullptr)
+        return;
+    for (const auto &entry : m_d->wrapperMapper) {
+        if (PyObject_TypeCheck(entry.second, type))
+            m_d->indexedWrappers.insert(entry.second);
     }
 }
 
@@ -53,6 +53,9 @@ namespace Shiboken
 struct DestructorEntry;
 
 typedef void (*ObjectVisitor)(SbkObject *, void *);
+/// Asks for runDeletionInMainThread() to be called in the main thread.
+/// Returns false if that is not possible.
+typedef bool (*DeletionInMainThreadNotifier)();
 
 class LIBSHIBOKEN_API BindingManager
 {
@@ -70,7 +73,13 @@ public:
     void releaseWrapper(SbkObject *wrapper);
 
     void runDeletionInMainThread();
+    /**
+     * Queues a C++ destructor to be run in the main thread. This can be
+     * called from any thread. The first entry of a batch notifies the main
+     * thread through a Python pending call and, if one is set, the notifier.
+     */
     void addToDeletionInMainThread(const DestructorEntry &);
+    void setDeletionInMainThreadNotifier(DeletionInMainThreadNotifier notifier);
 
     SbkObject *retrieveWrapper(const void *cptr);
     PyObject *getOverride(const void *cptr, PyObject *nameCache[], const char *methodName);
@@ -96,6 +105,24 @@ public:
      */
     void visitAllPyObjects(ObjectVisitor visitor, void *data);
 
+    /**
+     * Calls the function \p visitor for each registered object whose type is
+     * \p type or inherits from it, or for all objects if \p type is null.
+     * The visitor may release wrappers; objects released before their turn
+     * are skipped.
+     * \param type type of the objects to visit.
+     * \param visitor function called for each object.
+     * \param data user data passed as second argument to the visitor function.
+     */
+    void visitPyObjects(PyTypeObject *type, ObjectVisitor visitor, void *data);
+
+    /**
+     * Keeps an index of the live wrappers of \p type and its subtypes, which
+     * visitPyObjects() uses instead of scanning all wrappers when visiting
+     * that type. Only one type is indexed at a time; null removes the index.
+     */
+    void indexWrappersOfType(PyTypeObject *type);
+
 private:
     ~BindingManager();
     BindingManager();
@@ -45,6 +45,13 @@ namespace Shiboken
 GilState::GilState()
 {
     if (Py_IsInitialized()) {
+#if !defined(Py_LIMITED_API) && PY_VERSION_HEX >= 0x03040000
+        // Fast path for the common case of a callback on a thread that
+        // holds the GIL already. Note: PyGILState_Check() always returns
+        // true once sub-interpreters are used, which PySide does not support.
+        if (PyGILState_Check())
+            return;
+#endif
         m_gstate = PyGILState_Ensure();
         m_locked = true;
     }
@@ -70,5 +77,34 @@ void GilState::abandon()
     m_locked = false;
 }
 
+GilSession::GilSession(Mode mode)
+{
+    if (Py_IsInitialized()) {
+        m_gstate = PyGILState_Ensure();
+        m_active = true;
+        // Keep the thread state, but let other threads run in between,
+        // unless the GIL was held already when the session was started.
+        if (mode == ReleaseGil && m_gstate == PyGILState_UNLOCKED)
+            m_savedState = PyEval_SaveThread();
+    }
+}
+
+GilSession::~GilSession()
+{
+    end();
+}
+
+void GilSession::end()
+{
+    if (m_active && Py_IsInitialized()) {
+        if (m_savedState != nullptr) {
+            PyEval_RestoreThread(m_savedState);
+            m_savedState = nullptr;
+        }
+        PyGILState_Release(m_gstate);
+    }
+    m_active = false;
+}
+
 } // namespace Shiboken
 
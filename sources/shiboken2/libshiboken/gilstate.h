@@ -63,6 +63,33 @@ private:
     bool m_locked = false;
 };
 
+/**
+ * Scoped session for a batch of Python callbacks on a thread that was not
+ * created by Python. A GilState on such a thread creates a Python thread
+ * state and destroys it again when it goes out of scope. Within a session
+ * the thread state is kept, so each GilState only takes the GIL.
+ * With HoldGil, the GIL itself is held for the whole session and the
+ * GilState objects within take the fast path.
+ */
+class LIBSHIBOKEN_API GilSession
+{
+public:
+    enum Mode { ReleaseGil, HoldGil };
+
+    GilSession(const GilSession &) = delete;
+    GilSession(GilSession &&) = delete;
+    GilSession &operator=(const GilSession &) = delete;
+    GilSession &operator=(GilSession &&) = delete;
+
+    explicit GilSession(Mode mode = ReleaseGil);
+    ~GilSession();
+    void end();
+private:
+    PyGILState_STATE m_gstate;
+    PyThreadState *m_savedState = nullptr;
+    bool m_active = false;
+};
+
 } // namespace Shiboken
 
 #endif // GILSTATE_H
@@ -106,6 +106,13 @@ void init()
     initArrayConverters();
 }
 
+static void clearToCppConversionCache(const SbkConverter *converter)
+{
+    for (auto &entry : converter->toCppConversionCache)
+        entry = {nullptr, 0, nullptr};
+    converter->toCppConversionCacheNext = 0;
+}
+
 SbkConverter *createConverterObject(PyTypeObject *type,
                                            PythonToCppFunc toCppPointerConvFunc,
                                            IsConvertibleToCppFunc toCppPointerCheckFunc,
@@ -123,6 +130,8 @@ SbkConverter *createConverterObject(PyTypeObject *type,
     if (toCppPointerCheckFunc && toCppPointerConvFunc)
         converter->toCppPointerConversion = std::make_pair(toCppPointerCheckFunc, toCppPointerConvFunc);
     converter->toCppConversions.clear();
+    converter->typeOnlyConversions = 0;
+    clearToCppConversionCache(converter);
 
     return converter;
 }
@@ -170,7 +179,7 @@ void addPythonToCppValueConversion(SbkConverter *converter,
                                    PythonToCppFunc pythonToCppFunc,
                                    IsConvertibleToCppFunc isConvertibleToCppFunc)
 {
-    converter->toCppConversions.push_back(std::make_pair(isConvertibleToCppFunc, pythonToCppFunc));
+    addPythonToCppValueConversion(converter, pythonToCppFunc, isConvertibleToCppFunc, false);
 }
 void addPythonToCppValueConversion(SbkObjectType *type,
                                    PythonToCppFunc pythonToCppFunc,
@@ -178,6 +187,19 @@ void addPythonToCppValueConversion(SbkObjectType *type,
 {
     addPythonToCppValueConversion(PepType_SOTP(type)->converter, pythonToCppFunc, isConvertibleToCppFunc);
 }
+void addPythonToCppValueConversion(SbkConverter *converter,
+                                   PythonToCppFunc pythonToCppFunc,
+                                   IsConvertibleToCppFunc isConvertibleToCppFunc,
+                                   bool checksTypeOnly)
+{
+    // Only an uninterrupted run of type-only checks at the front of the
+    // list can be cached; a value-dependent check ends it.
+    if (checksTypeOnly && converter->typeOnlyConversions == converter->toCppConversions.size())
+        ++converter->typeOnlyConversions;
+    converter->toCppConversions.push_back(std::make_pair(isConvertibleToCppFunc, pythonToCppFunc));
+    // Conversions may be added by other modules after the cache was filled.
+    clearToCppConversionCache(converter);
+}
 
 PyObject *pointerToPython(SbkObjectType *type, const void *cppIn)
 {
@@ -245,11 +267,65 @@ PythonToCppFunc isPythonToCppPointerConvertible(SbkObjectType *type, PyObject *p
     return PepType_SOTP(type)->converter->toCppPointerConversion.first(pyIn);
 }
 
+static inline bool typeVersionTag(PyTypeObject *type, unsigned int *tag)
+{
+#ifndef Py_LIMITED_API
+    if (PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG) && type->tp_version_tag != 0) {
+        *tag = type->tp_version_tag;
+        return true;
+    }
+#else
+    SBK_UNUSED(type)
+    SBK_UNUSED(tag)
+#endif
+    return false;
+}
+
+static inline void cacheToCppConversion(const SbkConverter *converter, PyTypeObject *type,
+                                        unsigned int tag, PythonToCppFunc toCppFunc)
+{
+    const auto size = sizeof(converter->toCppConversionCache) / sizeof(converter->toCppConversionCache[0]);
+    converter->toCppConversionCache[converter->toCppConversionCacheNext++ % size] = {type, tag, toCppFunc};
+}
+
 static inline PythonToCppFunc IsPythonToCppConvertible(const SbkConverter *converter, PyObject *pyIn)
 {
     assert(pyIn);
-    for (const ToCppConversion &c : converter->toCppConversions) {
-        if (PythonToCppFunc toCppFunc = c.first(pyIn))
+    const ToCppConversionVector &conversions = converter->toCppConversions;
+    const std::size_t typeOnly = converter->typeOnlyConversions;
+    PyTypeObject *type = Py_TYPE(pyIn);
+    unsigned int tag = 0;
+    const bool cacheable = typeOnly > 0 && typeVersionTag(type, &tag);
+
+    bool cached = false;
+    if (cacheable) {
+        for (const auto &entry : converter->toCppConversionCache) {
+            if (entry.type == type && entry.versionTag == tag) {
+                if (entry.toCppFunc)
+                    return entry.toCppFunc;
+                cached = true; // None of the type-only checks match.
+                break;
+            }
+        }
+    }
+
+    std::size_t i = 0;
+    if (cached) {
+        i = typeOnly;
+    } else {
+        for ( ; i < typeOnly; ++i) {
+            if (PythonToCppFunc toCppFunc = conversions[i].first(pyIn)) {
+                if (cacheable)
+                    cacheToCppConversion(converter, type, tag, toCppFunc);
+                return toCppFunc;
+            }
+        }
+        if (cacheable)
+            cacheToCppConversion(converter, type, tag, nullptr);
+    }
+    // The remaining checks may depend on the value and are never cached.
+    for (const std::size_t size = conversions.size(); i < size; ++i) {
+        if (PythonToCppFunc toCppFunc = conversions[i].first(pyIn))
             return toCppFunc;
     }
     return nullptr;
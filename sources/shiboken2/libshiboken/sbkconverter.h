@@ -182,6 +182,16 @@ LIBSHIBOKEN_API void addPythonToCppValueConversion(SbkObjectType *type,
                                                    PythonToCppFunc pythonToCppFunc,
                                                    IsConvertibleToCppFunc isConvertibleToCppFunc);
 
+/**
+ *  Adds a new conversion of a Python object to a C++ value. If \p checksTypeOnly
+ *  is true, \p isConvertibleToCppFunc must depend only on the type of the
+ *  Python object, which allows the result of the check to be cached per type.
+ */
+LIBSHIBOKEN_API void addPythonToCppValueConversion(SbkConverter *converter,
+                                                   PythonToCppFunc pythonToCppFunc,
+                                                   IsConvertibleToCppFunc isConvertibleToCppFunc,
+                                                   bool checksTypeOnly);
+
 // C++ -> Python ---------------------------------------------------------------------------
 
 /**
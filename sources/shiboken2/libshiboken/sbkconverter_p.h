@@ -57,6 +57,18 @@ extern "C"
 using ToCppConversion = std::pair<IsConvertibleToCppFunc, PythonToCppFunc>;
 using ToCppConversionVector = std::vector<ToCppConversion>;
 
+/**
+ *  \internal
+ *  Remembers the outcome of the type-only checks of a converter for a
+ *  given Python type. A null toCppFunc means none of them matched.
+ */
+struct ToCppConversionCacheEntry
+{
+    PyTypeObject *type;
+    unsigned int versionTag;
+    PythonToCppFunc toCppFunc;
+};
+
 /**
  *  \internal
  *  Private structure of SbkConverter.
@@ -105,6 +117,20 @@ struct SbkConverter
      *  list is always empty.
      */
     ToCppConversionVector toCppConversions;
+    /**
+     *  Number of leading entries in toCppConversions whose type checking
+     *  functions depend only on the type of the Python object, not on its
+     *  value (copy conversions and conversions from wrapped types, enums
+     *  and flags). Their outcome is cached per Python type.
+     */
+    std::size_t typeOnlyConversions;
+    /**
+     *  Small cache of the outcome of the type-only conversions, keyed by
+     *  Python type and its tp_version_tag, so that a change to the type's
+     *  bases invalidates the entry.
+     */
+    mutable ToCppConversionCacheEntry toCppConversionCache[4];
+    mutable unsigned int toCppConversionCacheNext;
 };
 
 } // extern "C"
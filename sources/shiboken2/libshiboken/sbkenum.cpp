@@ -52,7 +52,7 @@
 #include <vector>
 
 #define SBK_ENUM(ENUM) reinterpret_cast<SbkEnumObject *>(ENUM)
-#define SBK_TYPE_CHECK(o) (strcmp(Py_TYPE(Py_TYPE(o))->tp_name, "Shiboken.EnumType") == 0)
+#define SBK_TYPE_CHECK(o) (Py_TYPE(Py_TYPE(o)) == SbkEnumType_TypeF())
 typedef PyObject *(*enum_func)(PyObject *, PyObject *);
 
 extern "C"
@@ -156,6 +156,50 @@ static PyObject *enum_op(enum_func f, PyObject *a, PyObject *b) {
     return result;
 }
 
+// Retrieves the value of an enum or integer operand without creating
+// temporary objects. Returns false for any other kind of operand.
+static bool enum_operand(PyObject *ob, long *value, bool *isEnum)
+{
+    *isEnum = SBK_TYPE_CHECK(ob);
+    if (*isEnum) {
+        *value = SBK_ENUM(ob)->ob_value;
+        return true;
+    }
+#ifndef IS_PY3K
+    if (PyInt_Check(ob)) {
+        *value = PyInt_AS_LONG(ob);
+        return true;
+    }
+#endif
+    if (PyLong_Check(ob)) {
+        int overflow;
+        *value = PyLong_AsLongAndOverflow(ob, &overflow);
+        return overflow == 0;
+    }
+    return false;
+}
+
+enum EnumBitwiseOp { EnumAnd, EnumOr, EnumXor };
+
+static PyObject *enum_bitwise_op(EnumBitwiseOp op, enum_func f, PyObject *a, PyObject *b)
+{
+    long valA, valB;
+    bool enumA, enumB;
+    if (!enum_operand(a, &valA, &enumA) || !enum_operand(b, &valB, &enumB)
+        || !(enumA || enumB)) {
+        return enum_op(f, a, b);
+    }
+    switch (op) {
+    case EnumAnd:
+        return PyInt_FromLong(valA & valB);
+    case EnumOr:
+        return PyInt_FromLong(valA | valB);
+    case EnumXor:
+        break;
+    }
+    return PyInt_FromLong(valA ^ valB);
+}
+
 /* Notes:
  *   On Py3k land we use long type when using integer numbers. However, on older
  *   versions of Python (version 2) we need to convert it to int type,
@@ -171,17 +215,17 @@ static PyObject *enum_int(PyObject *v)
 
 static PyObject *enum_and(PyObject *self, PyObject *b)
 {
-    return enum_op(PyNumber_And, self, b);
+    return enum_bitwise_op(EnumAnd, PyNumber_And, self, b);
 }
 
 static PyObject *enum_or(PyObject *self, PyObject *b)
 {
-return enum_op(PyNumber_Or, self, b);
+    return enum_bitwise_op(EnumOr, PyNumber_Or, self, b);
 }
 
 static PyObject *enum_xor(PyObject *self, PyObject *b)
 {
-    return enum_op(PyNumber_Xor, self, b);
+    return enum_bitwise_op(EnumXor, PyNumber_Xor, self, b);
 }
 
 static int enum_bool(PyObject *v)
@@ -213,6 +257,36 @@ static PyObject *enum_divide(PyObject *self, PyObject *v)
 
 static PyObject *enum_richcompare(PyObject *self, PyObject *other, int op)
 {
+    long a, b;
+    bool isEnumA, isEnumB;
+    if (enum_operand(self, &a, &isEnumA) && enum_operand(other, &b, &isEnumB)
+        && (isEnumA || isEnumB)) {
+        bool result;
+        switch (op) {
+        case Py_LT:
+            result = a < b;
+            break;
+        case Py_LE:
+            result = a <= b;
+            break;
+        case Py_EQ:
+            result = a == b;
+            break;
+        case Py_NE:
+            result = a != b;
+            break;
+        case Py_GT:
+            result = a > b;
+            break;
+        default:
+            result = a >= b;
+            break;
+        }
+        if (result)
+            Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+    }
+
     PyObject *valA = self;
     PyObject *valB = other;
     PyObject *result = nullptr;
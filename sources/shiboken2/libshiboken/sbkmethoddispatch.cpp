@@ -0,0 +1,132 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "sbkmethoddispatch.h"
+#include "basewrapper.h"
+
+#include <cstring>
+
+namespace Shiboken
+{
+namespace MethodDispatch
+{
+
+static PyTypeObject *moduleType(PyTypeObject ***moduleTypes, int typeIndex)
+{
+    return (*moduleTypes)[typeIndex];
+}
+
+static PythonToCppFunc isConvertible(const ArgumentSpec &spec, PyObject *pyIn)
+{
+    switch (spec.kind) {
+    case ArgumentKind::Primitive:
+        return Conversions::isPythonToCppConvertible(spec.primitiveConverter(), pyIn);
+    case ArgumentKind::Enum: {
+        PyTypeObject *type = moduleType(spec.moduleTypes, spec.typeIndex);
+        return Conversions::isPythonToCppConvertible(*PepType_SGTP(type)->converter, pyIn);
+    }
+    case ArgumentKind::ObjectPointer: {
+        PyTypeObject *type = moduleType(spec.moduleTypes, spec.typeIndex);
+        return Conversions::isPythonToCppPointerConvertible(reinterpret_cast<SbkObjectType *>(type), pyIn);
+    }
+    }
+    return nullptr;
+}
+
+// Mirrors the message of PyArg_UnpackTuple() used by the open-coded wrappers.
+static void setArgumentCountError(const MethodDescriptor &descriptor, Py_ssize_t numArgs)
+{
+    const char *name = std::strrchr(descriptor.fullName, '.');
+    name = name ? name + 1 : descriptor.fullName;
+    PyErr_Format(PyExc_TypeError, "%s expected %d arguments, got %d",
+                 name, descriptor.argumentCount, int(numArgs));
+}
+
+PyObject *call(PyObject *self, PyObject *args, const MethodDescriptor &descriptor)
+{
+    if (!Object::isValid(self))
+        return nullptr;
+    PyTypeObject *selfType = moduleType(descriptor.moduleTypes, descriptor.typeIndex);
+    void *cppSelf = Conversions::cppPointer(selfType, reinterpret_cast<SbkObject *>(self));
+
+    const int numArgs = descriptor.argumentCount;
+    PyObject *pyArgs[MaxArguments];
+    if (numArgs == 1) {
+        pyArgs[0] = args;
+    } else if (numArgs > 1) {
+        const Py_ssize_t size = PyTuple_GET_SIZE(args);
+        if (size != numArgs) {
+            setArgumentCountError(descriptor, size);
+            return nullptr;
+        }
+        for (int i = 0; i < numArgs; ++i)
+            pyArgs[i] = PyTuple_GET_ITEM(args, i);
+    }
+
+    PythonToCppFunc pythonToCpp[MaxArguments];
+    for (int i = 0; i < numArgs; ++i) {
+        pythonToCpp[i] = isConvertible(descriptor.arguments[i], pyArgs[i]);
+        if (!pythonToCpp[i]) {
+            setErrorAboutWrongArguments(args, descriptor.fullName, nullptr);
+            return nullptr;
+        }
+    }
+
+    Argument cppArgs[MaxArguments];
+    for (int i = 0; i < numArgs; ++i) {
+        if (descriptor.arguments[i].kind == ArgumentKind::ObjectPointer
+            && !Object::isValid(pyArgs[i])) {
+            return nullptr;
+        }
+        pythonToCpp[i](pyArgs[i], &cppArgs[i]);
+    }
+    if (PyErr_Occurred())
+        return nullptr;
+
+    PyObject *result = descriptor.call(cppSelf, cppArgs);
+    if (PyErr_Occurred() || !result) {
+        Py_XDECREF(result);
+        return nullptr;
+    }
+    return result;
+}
+
+} // namespace MethodDispatch
+} // namespace Shiboken
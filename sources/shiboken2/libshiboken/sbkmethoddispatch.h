@@ -0,0 +1,112 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef SBKMETHODDISPATCH_H
+#define SBKMETHODDISPATCH_H
+
+#include "sbkpython.h"
+#include "shibokenmacros.h"
+#include "sbkconverter.h"
+
+namespace Shiboken
+{
+namespace MethodDispatch
+{
+
+/// Maximum number of arguments of a method described by a MethodDescriptor.
+static const int MaxArguments = 8;
+
+/// Storage for one argument converted to C++; the conversion functions write
+/// the C++ value (a primitive, an enum or a pointer) at its address.
+union Argument
+{
+    void *pointer;
+    long long integer;
+    long double real;
+};
+
+enum class ArgumentKind : unsigned char
+{
+    Primitive,      // C++ primitive type passed by value
+    Enum,           // Enum or flags type passed by value
+    ObjectPointer   // Pointer to a wrapped type, None is passed as nullptr
+};
+
+struct ArgumentSpec
+{
+    ArgumentKind kind;
+    /// Type array of the module declaring the type (Enum, ObjectPointer).
+    PyTypeObject ***moduleTypes;
+    int typeIndex;
+    /// Converter of the type (Primitive).
+    SbkConverter *(*primitiveConverter)();
+};
+
+/// Calls the C++ method on \p cppSelf with the converted \p arguments and
+/// returns the result converted to Python.
+using MethodCall = PyObject *(*)(void *cppSelf, Argument *arguments);
+
+/**
+ *  Describes a method wrapper generated with --table-driven-wrappers: a
+ *  non-overloaded instance method without default values, modifications or
+ *  code injections whose arguments are all described by an ArgumentSpec.
+ *  The argument checks, conversions and error handling of all such methods
+ *  are done by call(); only the C++ call itself is generated per method.
+ */
+struct MethodDescriptor
+{
+    const char *fullName;
+    /// Type array of the module declaring the class and the index of the class.
+    PyTypeObject ***moduleTypes;
+    int typeIndex;
+    int argumentCount;
+    const ArgumentSpec *arguments;
+    MethodCall call;
+};
+
+/// Calls the method described by \p descriptor on \p self. \p args is unused
+/// for methods without arguments, the argument itself for methods taking one
+/// (METH_O) and the argument tuple otherwise (METH_VARARGS).
+LIBSHIBOKEN_API PyObject *call(PyObject *self, PyObject *args, const MethodDescriptor &descriptor);
+
+} // namespace MethodDispatch
+} // namespace Shiboken
+
+#endif // SBKMETHODDISPATCH_H
@@ -72,8 +72,39 @@ PyObject *import(const char *moduleName)
     return module;
 }
 
+// Returns whether the calling thread runs in the main interpreter. The
+// interpreter state is compared instead of remembering the one that imported
+// the first module, since its address can change when an embedding
+// application calls Py_Finalize() and Py_Initialize() again.
+static bool isMainInterpreter()
+{
+#if defined(Py_LIMITED_API)
+    return true; // Unknown, the check is skipped.
+#else
+    PyInterpreterState *current = PyThreadState_Get()->interp;
+#  if PY_VERSION_HEX >= 0x03080000
+    return current == PyInterpreterState_Main();
+#  else
+    // New interpreters are prepended to the list, so the main one is last.
+    PyInterpreterState *mainInterpreter = PyInterpreterState_Head();
+    while (PyInterpreterState *next = PyInterpreterState_Next(mainInterpreter))
+        mainInterpreter = next;
+    return current == mainInterpreter;
+#  endif
+#endif
+}
+
 PyObject *create(const char *moduleName, void *moduleData)
 {
+    // The binding state (wrapper map, converters, type objects) is shared by
+    // the whole process. Refuse to mix it into a sub-interpreter.
+    if (!isMainInterpreter()) {
+        PyErr_Format(PyExc_ImportError,
+                     "Module '%s' cannot be imported into a sub-interpreter; the binding "
+                     "state is shared by all modules of the process and bound to the "
+                     "main interpreter.", moduleName);
+        return nullptr;
+    }
     Shiboken::init();
 #ifndef IS_PY3K
     return Py_InitModule(moduleName, reinterpret_cast<PyMethodDef *>(moduleData));
@@ -0,0 +1,156 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef SBKOVERLOADCACHE_H
+#define SBKOVERLOADCACHE_H
+
+#include "sbkpython.h"
+#include "shibokenmacros.h"
+#include "sbkconverter.h"
+
+namespace Shiboken
+{
+namespace OverloadCache
+{
+
+/// Number of argument type signatures remembered by each call site.
+static const int Ways = 4;
+
+/// Returns whether inline caching of overload decisions is active
+/// (default: true). The generator option --enable-overload-cache decides
+/// whether a binding contains call site caches at all.
+LIBSHIBOKEN_API bool isEnabled();
+
+/// Switches inline caching of overload decisions on or off at runtime,
+/// returning the previous state. Existing entries are ignored while disabled.
+LIBSHIBOKEN_API bool setEnabled(bool enabled);
+
+/// Returns whether the overload decisor result for \p arg depends on the
+/// type of \p arg only, so that it may be cached keyed on Py_TYPE(arg).
+/// This holds for wrapper instances, enums, None and exact int, float and
+/// bool objects; strings and sequences may be accepted or rejected
+/// depending on their contents (QChar, containers) and are never cached.
+LIBSHIBOKEN_API bool isCacheableArgument(PyObject *arg);
+
+/**
+ *  Inline cache of overload decisor results for one generated function
+ *  wrapper taking up to \p N arguments. An entry maps the exact Python
+ *  types of the positional arguments to the selected overload id and the
+ *  Python to C++ conversion functions found while type checking them.
+ *  Types are referenced by the cache so that their addresses cannot be
+ *  reused for different types while an entry holds them.
+ */
+template <int N>
+class Site
+{
+public:
+    bool lookup(Py_ssize_t numArgs, PyObject *const *args,
+                int *overloadId, PythonToCppFunc *converters) const;
+    void store(Py_ssize_t numArgs, PyObject *const *args,
+               int overloadId, const PythonToCppFunc *converters);
+
+private:
+    struct Entry
+    {
+        PyTypeObject *types[N];
+        PythonToCppFunc converters[N];
+        Py_ssize_t numArgs;
+        int overloadId;
+    };
+
+    Entry m_entries[Ways] = {};
+    int m_size = 0;
+    int m_next = 0;
+};
+
+template <int N>
+inline bool Site<N>::lookup(Py_ssize_t numArgs, PyObject *const *args,
+                            int *overloadId, PythonToCppFunc *converters) const
+{
+    if (m_size == 0 || numArgs > N || !isEnabled())
+        return false;
+    for (int w = 0; w < m_size; ++w) {
+        const Entry &entry = m_entries[w];
+        if (entry.numArgs != numArgs)
+            continue;
+        Py_ssize_t i = 0;
+        while (i < numArgs && Py_TYPE(args[i]) == entry.types[i])
+            ++i;
+        if (i != numArgs)
+            continue;
+        *overloadId = entry.overloadId;
+        for (int c = 0; c < N; ++c)
+            converters[c] = entry.converters[c];
+        return true;
+    }
+    return false;
+}
+
+template <int N>
+inline void Site<N>::store(Py_ssize_t numArgs, PyObject *const *args,
+                           int overloadId, const PythonToCppFunc *converters)
+{
+    if (numArgs > N || !isEnabled())
+        return;
+    for (Py_ssize_t i = 0; i < numArgs; ++i) {
+        if (!isCacheableArgument(args[i]))
+            return;
+    }
+    Entry &entry = m_entries[m_next];
+    if (m_next < m_size) {
+        for (Py_ssize_t i = 0; i < entry.numArgs; ++i)
+            Py_DECREF(reinterpret_cast<PyObject *>(entry.types[i]));
+    }
+    for (Py_ssize_t i = 0; i < numArgs; ++i) {
+        entry.types[i] = Py_TYPE(args[i]);
+        Py_INCREF(reinterpret_cast<PyObject *>(entry.types[i]));
+    }
+    for (int c = 0; c < N; ++c)
+        entry.converters[c] = converters[c];
+    entry.numArgs = numArgs;
+    entry.overloadId = overloadId;
+    m_next = (m_next + 1) % Ways;
+    if (m_size < Ways)
+        ++m_size;
+}
+
+} // namespace OverloadCache
+} // namespace Shiboken
+
+#endif // SBKOVERLOADCACHE_H
@@ -51,6 +51,8 @@
 #include "sbkconverter.h"
 #include "sbkenum.h"
 #include "sbkmodule.h"
+#include "sbkmethoddispatch.h"
+#include "sbkoverloadcache.h"
 #include "sbkstring.h"
 #include "sbkstaticstrings.h"
 #include "shibokenmacros.h"
@@ -274,9 +274,21 @@ static PyObject *get_signature(PyObject * /* self */, PyObject *args)
     Py_RETURN_NONE;
 }
 
+static PyObject *adjustFuncName(const char *func_name);
+
+static PyObject *adjust_func_name(PyObject * /* self */, PyObject *args)
+{
+    const char *func_name;
+    if (!PyArg_ParseTuple(args, "s", &func_name))
+        return nullptr;
+    return adjustFuncName(func_name);
+}
+
 PyMethodDef signature_methods[] = {
     {"get_signature", (PyCFunction)get_signature, METH_VARARGS,
         "get the __signature__, but pass an optional string parameter"},
+    {"adjust_func_name", (PyCFunction)adjust_func_name, METH_VARARGS,
+        "modify a function name expression according to the active features"},
     {nullptr, nullptr}
 };
 
@@ -520,6 +532,9 @@ void SetError_Argument(PyObject *args, const char *func_name, PyObject *info)
      * This function replaces the type error construction with extra
      * overloads parameter in favor of using the signature module.
      * Error messages are rare, so we do it completely in Python.
+     * When no overload matched, a lazy TypeError or ValueError subclass
+     * is raised that adjusts the function name and formats its message
+     * on first access.
      */
     init_module_1();
     init_module_2();
@@ -531,14 +546,23 @@ void SetError_Argument(PyObject *args, const char *func_name, PyObject *info)
         PyErr_Fetch(&e, &v, &t);
         info = v;
     }
+    if (info == nullptr) {
+        AutoDecRef name(String::fromCString(func_name));
+        AutoDecRef err(PyObject_CallFunctionObjArgs(pyside_globals->make_argument_error_func,
+                                                    args, name.object(), nullptr));
+        if (err.isNull()) {
+            PyErr_Print();
+            Py_FatalError("make_argument_error did not receive a result");
+        }
+        PyErr_SetObject(reinterpret_cast<PyObject *>(Py_TYPE(err.object())), err);
+        return;
+    }
     // PYSIDE-1019: Modify the function name expression according to feature.
     AutoDecRef new_func_name(adjustFuncName(func_name));
     if (new_func_name.isNull()) {
         PyErr_Print();
         Py_FatalError("seterror_argument failed to call update_mapping");
     }
-    if (info == nullptr)
-        info = Py_None;
     AutoDecRef res(PyObject_CallFunctionObjArgs(pyside_globals->seterror_argument_func,
                                                 args, new_func_name.object(), info, nullptr));
     if (res.isNull()) {
@@ -214,6 +214,9 @@ static int init_phase_2(safe_globals_struc *p, PyMethodDef *methods)
         p->seterror_argument_func = PyObject_GetAttrString(loader, "seterror_argument");
         if (p->seterror_argument_func == nullptr)
             goto error;
+        p->make_argument_error_func = PyObject_GetAttrString(loader, "make_argument_error");
+        if (p->make_argument_error_func == nullptr)
+            goto error;
         p->make_helptext_func = PyObject_GetAttrString(loader, "make_helptext");
         if (p->make_helptext_func == nullptr)
             goto error;
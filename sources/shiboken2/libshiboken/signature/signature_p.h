@@ -57,6 +57,7 @@ typedef struct safe_globals_struc {
     PyObject *pyside_type_init_func;
     PyObject *create_signature_func;
     PyObject *seterror_argument_func;
+    PyObject *make_argument_error_func;
     PyObject *make_helptext_func;
     PyObject *finish_import_func;
 } safe_globals_struc, *safe_globals;
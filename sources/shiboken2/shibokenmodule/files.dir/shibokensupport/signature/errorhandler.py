@@ -60,6 +60,7 @@ import sys
 
 from shibokensupport.signature import inspect
 from shibokensupport.signature import get_signature
+from shibokensupport.signature import adjust_func_name
 from shibokensupport.signature.mapping import update_mapping, namespace
 from textwrap import dedent
 
@@ -129,14 +130,22 @@ def seterror_argument(args, func_name, info):
     # temp!
     found = matched_type(args, sigs)
     if found:
-        msg = dedent("""
-            '{func_name}' called with wrong argument values:
-              {func_name}{args}
-            Found signature:
-              {func_name}{found}
-            """.format(**locals())).strip()
-        return ValueError, msg
+        return ValueError, wrong_values_message(func_name, args, found)
     type_str = ", ".join(type(arg).__name__ for arg in args)
+    # We don't raise the error here, to avoid the loader in the traceback.
+    return TypeError, wrong_types_message(func_name, type_str, sigs)
+
+
+def wrong_values_message(func_name, args, found):
+    return dedent("""
+        '{func_name}' called with wrong argument values:
+          {func_name}{args}
+        Found signature:
+          {func_name}{found}
+        """.format(**locals())).strip()
+
+
+def wrong_types_message(func_name, type_str, sigs):
     msg = dedent("""
         '{func_name}' called with wrong argument types:
           {func_name}({type_str})
@@ -144,8 +153,129 @@ def seterror_argument(args, func_name, info):
         """.format(**locals())).strip()
     for sig in sigs:
         msg += "\n  {func_name}{sig}".format(**locals())
-    # We don't raise the error here, to avoid the loader in the traceback.
-    return TypeError, msg
+    return msg
+
+
+_argument_signatures_cache = {}
+
+def argument_signatures(func_name):
+    """
+    Returns the list of signatures of the function 'func_name' that
+    'make_argument_error' matches the arguments against.
+
+    They are cached per name, so that code calling a function with wrong
+    arguments repeatedly does not evaluate the name and compute the
+    signatures on every call. The name is evaluated as given, which works
+    unless a feature (snake_case, true_property) renamed the function.
+    Only then is it adjusted here.
+    """
+    sigs = _argument_signatures_cache.get(func_name)
+    if sigs is None:
+        try:
+            func = eval(func_name, namespace)
+        except Exception:
+            func = eval(adjust_func_name(func_name), namespace)
+        sigs = get_signature(func, "typeerror")
+        if not sigs:
+            sigs = []
+        elif type(sigs) != list:
+            sigs = [sigs]
+        _argument_signatures_cache[func_name] = sigs
+    return sigs
+
+
+def make_argument_error(args, func_name):
+    """
+    Returns the exception for a call that no overload accepts, like
+    'seterror_argument(args, func_name, None)' but with a lazy message.
+
+    The exception class has to be known when raising, so the signatures
+    are matched right away.
+    """
+    if type(args) != tuple:
+        args = (args,)
+    found = None
+    try:
+        found = matched_type(args, argument_signatures(func_name))
+    except Exception:
+        # The message reports the error
+        pass
+    if found:
+        return ArgumentValueError(func_name, "{}".format(args), found)
+    return ArgumentTypeError(func_name, tuple(type(arg).__name__ for arg in args))
+
+
+class _LazyArgumentMessage(object):
+    """
+    Message of the exceptions returned by 'make_argument_error'.
+
+    Code that probes an API with 'try/except TypeError' often never looks
+    at the message. Formatting it needs the feature-adjusted function name
+    and all signatures, so it is only done when 'str()' or 'args' is
+    accessed. No argument objects are kept alive by the exception.
+    """
+    def _get_message(self):
+        if self._message is None:
+            self._message = self._format_message(adjust_func_name(self._func_name))
+        return self._message
+
+    @property
+    def args(self):
+        return (self._get_message(),)
+
+    @args.setter
+    def args(self, value):
+        value = tuple(value)
+        self._message = value[0] if len(value) == 1 else str(value)
+
+    def __str__(self):
+        return self._get_message()
+
+    def __repr__(self):
+        return "{}({!r})".format(type(self).__name__, self._get_message())
+
+    def __reduce__(self):
+        return self._builtin_type, self.args
+
+
+class ArgumentTypeError(_LazyArgumentMessage, TypeError):
+    """TypeError for arguments of types that no overload accepts."""
+    _builtin_type = TypeError
+
+    def __init__(self, func_name, type_names):
+        TypeError.__init__(self, func_name, type_names)
+        self._func_name = func_name
+        self._type_names = type_names
+        self._message = None
+
+    def _format_message(self, func_name):
+        try:
+            sigs = argument_signatures(self._func_name)
+        except Exception as e:
+            return "Internal error evaluating {func_name}: {e}".format(**locals())
+        if not sigs:
+            return "{}({}) is wrong (missing signature)".format(
+                func_name, ", ".join(self._type_names))
+        return wrong_types_message(func_name, ", ".join(self._type_names), sigs)
+
+
+class ArgumentValueError(_LazyArgumentMessage, ValueError):
+    """
+    ValueError for arguments whose types match a signature, but which no
+    overload accepts.
+    """
+    _builtin_type = ValueError
+
+    def __init__(self, func_name, args_text, found):
+        ValueError.__init__(self, func_name, args_text)
+        self._func_name = func_name
+        self._args_text = args_text
+        self._found = found
+        self._message = None
+
+    def _format_message(self, func_name):
+        return wrong_values_message(func_name, self._args_text, self._found)
+
 
 def check_string_type(s):
     if sys.version_info[0] == 3:
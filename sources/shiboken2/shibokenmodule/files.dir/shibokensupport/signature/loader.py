@@ -104,6 +104,10 @@ def create_signature(props, key):
 def seterror_argument(args, func_name, info):
     return errorhandler.seterror_argument(args, func_name, info)
 
+# name used in signature.cpp
+def make_argument_error(args, func_name):
+    return errorhandler.make_argument_error(args, func_name)
+
 # name used in signature.cpp
 def make_helptext(func):
     return errorhandler.make_helptext(func)
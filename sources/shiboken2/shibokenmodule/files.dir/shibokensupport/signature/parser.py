@@ -96,6 +96,39 @@ def _parse_arglist(argstr):
     return [x.strip() for x in split(argstr) if x.strip() not in ("", ",")]
 
 
+# Separators of the signature lines written with "--compact-signatures".
+# See "CppGenerator::writeCompactSignatureInfo()".
+_FIELD_SEP = "\x1f"
+_ARG_SEP = "\x1e"
+
+
+def _split_line(line):
+    """
+    Split a pre-tokenized signature line without regular expressions:
+
+        [n:]funcname US [returntype] { US argname RS argtype [RS default] }
+    """
+    fields = line.split(_FIELD_SEP)
+    head, returntype = fields[0], fields[1]
+    multi, _, funcname = head.rpartition(":")
+    args = []
+    for field in fields[2:]:
+        tup = field.split(_ARG_SEP, 2)
+        name = tup[0]
+        if name in keyword.kwlist:
+            if LIST_KEYWORDS:
+                print("KEYWORD", line)
+            tup[0] = name + "_"
+        if len(tup) == 3:
+            # PYSIDE-1095: Handle arbitrary default expressions
+            tup[2] = tup[2].replace("->", ".deref.")
+        args.append(tuple(tup))
+    if funcname.split(".")[-1] in keyword.kwlist:
+        funcname = funcname + "_"
+    return dict(multi=int(multi) if multi else None, funcname=funcname,
+                arglist=args, returntype=returntype or None)
+
+
 def _parse_line(line):
     line_re = r"""
         ((?P<multi> ([0-9]+)) : )?    # the optional multi-index
@@ -316,7 +349,9 @@ def handle_retvar(obj):
 
 
 def calculate_props(line):
-    parsed = SimpleNamespace(**_parse_line(line.strip()))
+    # Note: the compact separators count as whitespace for str.strip().
+    parsed = SimpleNamespace(**(_split_line(line) if _FIELD_SEP in line
+                                else _parse_line(line.strip())))
     arglist = parsed.arglist
     annotations = {}
     _defaults = []
@@ -265,7 +265,8 @@ int main(int argc, char **argv)
 
     optJoinNamespaces = parser.isSet(joinNamespacesOption);
 
-    const FileModelItem dom = AbstractMetaBuilderPrivate::buildDom(arguments, level, 0);
+    const FileModelItem dom =
+        AbstractMetaBuilderPrivate::buildDom(QVector<QByteArrayList>{arguments}, level, 0);
     if (dom.isNull()) {
         QString message = QLatin1String("Unable to parse ") + positionalArguments.join(QLatin1Char(' '));
         std::cerr << qPrintable(message) << '\n';
@@ -0,0 +1,65 @@
+/****************************************************************************
+**
+** Copyright (C) 2021 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef OTHEROVERLOAD_H
+#define OTHEROVERLOAD_H
+
+#include "libothermacros.h"
+#include "echo.h"
+#include "overload.h"
+#include "point.h"
+#include "pointf.h"
+#include "rect.h"
+#include "str.h"
+
+#include <list>
+
+// Overloads taking types of the sample module, for testing the inline cache of
+// overload decisions of the other module (--enable-overload-cache).
+class OtherOverload
+{
+public:
+    // Similar to Overload::drawText(...)
+    Overload::FunctionEnum drawText(const Point&, const Str&) { return Overload::Function0; }
+    Overload::FunctionEnum drawText(const PointF&, const Str&) { return Overload::Function1; }
+    Overload::FunctionEnum drawText(const Rect&, int, const Str&) { return Overload::Function2; }
+    Overload::FunctionEnum drawText(const RectF&, int, const Str&) { return Overload::Function3; }
+    Overload::FunctionEnum drawText(const RectF&, const Str&, const Echo& = Echo()) { return Overload::Function4; }
+    Overload::FunctionEnum drawText(int, int, const Str&) { return Overload::Function5; }
+    Overload::FunctionEnum drawText(int, int, int, int, int, const Str&) { return Overload::Function6; }
+
+    inline Overload::FunctionEnum intDoubleOverloads(int, int) const { return Overload::Function0; }
+    inline Overload::FunctionEnum intDoubleOverloads(double, double) const { return Overload::Function1; }
+
+    // Overloads taking containers are never cached.
+    inline const char *listOverload(const Point&) { return "Point"; }
+    inline const char *listOverload(const std::list<Point>&) { return "list(Point)"; }
+};
+
+#endif // OTHEROVERLOAD_H
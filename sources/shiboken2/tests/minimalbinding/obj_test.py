@@ -63,6 +63,16 @@ class ObjTest(unittest.TestCase):
         obj = Obj(objId)
         self.assertEqual(obj.objId(), objId)
 
+    def testSimpleMethodArguments(self):
+        # objId() and setObjId() are dispatched through method descriptors.
+        obj = Obj(0)
+        obj.setObjId(42)
+        self.assertEqual(obj.objId(), 42)
+        self.assertRaises(TypeError, obj.setObjId, 'not an int')
+        self.assertRaises(TypeError, obj.setObjId, 1, 2)
+        self.assertRaises(TypeError, obj.objId, 1)
+        self.assertEqual(obj.objId(), 42)
+
     def testNormalMethodFromExtendedClass(self):
         objId = 123
         obj = ExtObj(objId)
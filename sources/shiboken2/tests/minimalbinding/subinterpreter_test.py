@@ -0,0 +1,75 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+
+'''Test cases for importing a binding into a sub-interpreter'''
+
+import os
+import sys
+import unittest
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from shiboken_paths import init_paths
+init_paths()
+
+try:
+    import _testcapi
+except ImportError:
+    _testcapi = None
+
+
+@unittest.skipUnless(_testcapi is not None and hasattr(_testcapi, 'run_in_subinterp'),
+                     'requires _testcapi.run_in_subinterp')
+class SubInterpreterTest(unittest.TestCase):
+
+    def testImportOnlyInMainInterpreter(self):
+        self.assertNotIn('minimal', sys.modules)
+        # The sub-interpreter imports the binding first, so the check must
+        # not depend on the interpreter that imported the first module.
+        code = '''if True:
+            import sys
+            sys.path[:] = {!r}
+            try:
+                import minimal
+            except ImportError as e:
+                if 'sub-interpreter' not in str(e):
+                    raise
+            else:
+                raise RuntimeError('minimal was imported into a sub-interpreter')
+            '''.format(sys.path)
+        self.assertEqual(_testcapi.run_in_subinterp(code), 0)
+
+        import minimal
+        self.assertEqual(minimal.Obj(3).objId(), 3)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -32,5 +32,6 @@
 #include "otherderived.h"
 #include "otherobjecttype.h"
 #include "othermultiplederived.h"
+#include "otheroverload.h"
 #include "othertypesystypedef.h"
 #include "smartptrtester.h"
@@ -0,0 +1,64 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Compares heavily overloaded calls with and without the inline cache of
+overload decisions. This is not run as part of the test suite.'''
+
+import os
+import sys
+import timeit
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from shiboken_paths import init_paths
+init_paths()
+
+import shiboken2 as shiboken
+from sample import RectF, Str
+from other import OtherOverload
+
+
+def main(number=100000):
+    overload = OtherOverload()
+    rectF = RectF()
+    text = Str('text')
+    stmt = lambda: overload.drawText(rectF, 1, text)
+    shiboken._setOverloadCacheEnabled(False)
+    try:
+        uncached = min(timeit.repeat(stmt, number=number, repeat=3))
+    finally:
+        shiboken._setOverloadCacheEnabled(True)
+    cached = min(timeit.repeat(stmt, number=number, repeat=3))
+    print("drawText(RectF, int, Str) x {}: decisor {:.3f}s, cached {:.3f}s"
+          .format(number, uncached, cached))
+
+
+if __name__ == '__main__':
+    main()
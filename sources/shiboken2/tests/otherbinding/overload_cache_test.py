@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2021 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+
+'''Test cases for the inline cache of overload decisions (--enable-overload-cache)'''
+
+import os
+import sys
+import unittest
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from shiboken_paths import init_paths
+init_paths()
+
+import shiboken2 as shiboken
+from sample import Echo, Overload, Point, PointF, Rect, RectF, Str
+from other import OtherOverload
+
+
+class DerivedPoint(Point):
+    pass
+
+
+class OverloadCacheTest(unittest.TestCase):
+    '''The cached decisor must select the same overloads as the plain one.'''
+
+    def setUp(self):
+        self.overload = OtherOverload()
+        self.text = Str('text')
+
+    def drawTextCalls(self):
+        return [((Point(), self.text), Overload.Function0),
+                ((PointF(), self.text), Overload.Function1),
+                ((Rect(), 1, self.text), Overload.Function2),
+                ((RectF(), 1, self.text), Overload.Function3),
+                ((RectF(), self.text), Overload.Function4),
+                ((RectF(), self.text, Echo()), Overload.Function4),
+                ((1, 2, self.text), Overload.Function5),
+                ((1, 2, 3, 4, 5, self.text), Overload.Function6)]
+
+    def testPolymorphicCallSite(self):
+        '''More argument type signatures than cache entries, repeatedly.'''
+        calls = self.drawTextCalls()
+        for i in range(3):
+            for args, expected in calls:
+                self.assertEqual(self.overload.drawText(*args), expected)
+
+    def testSameTypesRepeated(self):
+        for i in range(10):
+            self.assertEqual(self.overload.intDoubleOverloads(1, 2), Overload.Function0)
+            self.assertEqual(self.overload.intDoubleOverloads(1.0, 2.0), Overload.Function1)
+
+    def testSubclassArgument(self):
+        self.assertEqual(self.overload.drawText(Point(), self.text), Overload.Function0)
+        self.assertEqual(self.overload.drawText(DerivedPoint(), self.text), Overload.Function0)
+        self.assertEqual(self.overload.drawText(Point(), self.text), Overload.Function0)
+
+    def testUncacheableArguments(self):
+        '''Strings are checked by value (QChar-like types), they bypass the cache.'''
+        for i in range(3):
+            self.assertEqual(self.overload.drawText(Point(), 'text'), Overload.Function0)
+            self.assertEqual(self.overload.drawText(1, 2, 'text'), Overload.Function5)
+
+    def testErrorNotCached(self):
+        for i in range(3):
+            self.assertRaises(TypeError, self.overload.drawText, self.text, self.text)
+        self.assertEqual(self.overload.drawText(Point(), self.text), Overload.Function0)
+
+    def testNonCacheableFunction(self):
+        '''Overloads taking containers are never cached.'''
+        for i in range(3):
+            self.assertEqual(self.overload.listOverload(Point()), "Point")
+            self.assertEqual(self.overload.listOverload([Point()]), "list(Point)")
+
+    def testCacheToggle(self):
+        '''The same overload is called with the cache disabled and enabled.'''
+        rectF = RectF()
+        shiboken._setOverloadCacheEnabled(False)
+        try:
+            self.assertEqual(self.overload.drawText(rectF, 1, self.text), Overload.Function3)
+        finally:
+            shiboken._setOverloadCacheEnabled(True)
+        self.assertEqual(self.overload.drawText(rectF, 1, self.text), Overload.Function3)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -39,7 +39,9 @@ sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 from shiboken_paths import init_paths
 init_paths()
 
-from other import OtherObjectType
+import inspect
+
+from other import OtherDerived, OtherObjectType
 from shiboken_test_helper import objectFullname
 
 class SignatureTest(unittest.TestCase):
@@ -50,5 +52,26 @@ class SignatureTest(unittest.TestCase):
         argType = OtherObjectType.enumAsInt.__signature__.parameters['value'].annotation
         self.assertEqual(objectFullname(argType), 'sample.SampleNamespace.SomeClass.PublicScopedEnum')
 
+    # The other module is generated with "compact-signatures"; the
+    # pre-split lines must give the same signatures as the text lines.
+    def testCompactDefaultValue(self):
+        sig = inspect.signature(OtherDerived.__init__)
+        param = sig.parameters['id']
+        self.assertEqual(param.default, -1)
+        self.assertEqual(param.annotation, int)
+
+    def testCompactSelfAndReturnType(self):
+        sig = OtherDerived.useObjectTypeFromOtherModule.__signature__
+        self.assertEqual(list(sig.parameters), ['self', 'arg__1'])
+        sig = OtherDerived.createObject.__signature__
+        self.assertEqual(list(sig.parameters), [])
+        self.assertEqual(objectFullname(sig.return_annotation), 'sample.Abstract')
+
+    def testCompactMultipleSignatures(self):
+        sigs = OtherDerived.useValueTypeFromOtherModule.__signature__
+        self.assertEqual(len(sigs), 2)
+        returnTypes = [objectFullname(sig.return_annotation) for sig in sigs]
+        self.assertIn('sample.Event', returnTypes)
+
 if __name__ == '__main__':
     unittest.main()
@@ -66,6 +66,19 @@ class ImplicitConvTest(unittest.TestCase):
         ic = ImplicitConv(None)
         self.assertEqual(ic.ctorEnum(), ImplicitConv.CtorPrimitiveType)
 
+    def testRepeatedImplicitConversions(self):
+        '''Conversions decided by the type of the argument give the same result when repeated.'''
+        class ObjectTypeSubclass(ObjectType):
+            pass
+        objects = [ImplicitConv(), ObjectType(), ObjectTypeSubclass(), ImplicitConv.CtorThree]
+        expected = [ImplicitConv.CtorNone, ImplicitConv.CtorObjectTypeReference,
+                    ImplicitConv.CtorObjectTypeReference, ImplicitConv.CtorThree]
+        for i in range(3):
+            for obj, ctorEnum in zip(objects, expected):
+                ic = ImplicitConv.implicitConvCommon(obj)
+                self.assertEqual(ic.ctorEnum(), ctorEnum)
+            self.assertRaises(TypeError, ImplicitConv.implicitConvCommon, 'string')
+
 
 if __name__ == '__main__':
     unittest.main()
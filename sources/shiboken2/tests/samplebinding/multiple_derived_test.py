@@ -221,6 +221,15 @@ class MultipleDerivedTest(unittest.TestCase):
         self.assertEqual(a, b3_inherited)
         self.assertEqual(sys.getrefcount(a), refcnt + 2)
 
+    def testInheritedMethodsOfMDerived3(self):
+        '''Methods inherited from bases at non-zero offsets are called on the right subobject.'''
+        a = MDerived3()
+        self.assertEqual(a.mderived3Method(), 3000)
+        self.assertEqual(a.mderived2Method(), 200)
+        self.assertEqual(a.mderived1Method(), 100)
+        self.assertEqual(a.base3Method(), 3)
+        self.assertEqual(MDerived2.mderived2Method(a), 200)
+
 if __name__ == '__main__':
     unittest.main()
 
@@ -163,6 +163,40 @@ class OverloadTest(unittest.TestCase):
                                         TypeError, 'called with wrong argument types:')
         self.assertTrue(result)
 
+    def testDrawText3ExceptionIsLazy(self):
+        overload = Overload()
+        text = Str()
+        refCount = sys.getrefcount(text)
+        try:
+            overload.drawText3(text, Str(), Str(), 4, 5)
+        except TypeError as e:
+            error = e
+        # The exception keeps no references to the arguments.
+        self.assertEqual(sys.getrefcount(text), refCount)
+        # The message is built on demand, but must stay the same.
+        self.assertTrue(issubclass(type(error), TypeError))
+        self.assertFalse(issubclass(type(error), ValueError))
+        self.assertIn('called with wrong argument types:', str(error))
+        self.assertEqual(error.args, (str(error),))
+
+    def testDrawText3ExceptionCachesSignatures(self):
+        overload = Overload()
+        args = (Str(), Str(), Str(), 4, 5)
+        self.assertRaises(TypeError, overload.drawText3, *args)
+        # Raising again does not compute the signatures again.
+        from shibokensupport.signature import errorhandler
+        computed = []
+        get_signature = errorhandler.get_signature
+        def counting_get_signature(*args):
+            computed.append(args)
+            return get_signature(*args)
+        errorhandler.get_signature = counting_get_signature
+        try:
+            self.assertRaises(TypeError, overload.drawText3, *args)
+        finally:
+            errorhandler.get_signature = get_signature
+        self.assertEqual(computed, [])
+
     def testDrawText4(self):
         overload = Overload()
         self.assertEqual(overload.drawText4(1, 2, 3), Overload.Function0)
@@ -119,5 +119,11 @@ class TestShiboken(unittest.TestCase):
         shiboken.delete(obj)
         self.assertFalse(obj in shiboken.getAllValidWrappers())
 
+    def testAllWrappersListedOnce(self):
+        # Multiple inheritance registers the wrapper under each base pointer.
+        obj = MDerived1()
+        wrappers = shiboken.getAllValidWrappers()
+        self.assertEqual(len([w for w in wrappers if w is obj]), 1)
+
 if __name__ == '__main__':
     unittest.main()
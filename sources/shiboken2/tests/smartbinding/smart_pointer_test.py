@@ -214,6 +214,17 @@ class SmartPointerTests(unittest.TestCase):
         except AttributeError as error:
             self.assertEqual(error.args[0], "'smart.SharedPtr_Obj' object has no attribute 'typo'")
 
+    def testPointeeWrapperIsReused(self):
+        o = Obj()
+        ptrToObj = o.giveSharedPtrToObj()
+        obj = ptrToObj.data()
+        # Attributes forwarded to the pointee are looked up on its existing wrapper.
+        self.assertTrue(ptrToObj.takeInteger.__self__ is obj)
+        obj.m_integer = 7
+        self.assertEqual(ptrToObj.m_integer, 7)
+        # Attributes of the smart pointer itself take precedence.
+        self.assertEqual(ptrToObj.useCount(), 1)
+
     def testSmartPointerConversions(self):
         # Create Obj.
         o = Obj()